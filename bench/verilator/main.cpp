@@ -78,8 +78,8 @@ int main(int argc, char** argv)
         testbench->opentrace("waveform.vcd");
     }
 
-    // Run the testbench for 20 cycles
-    testbench->run();
+    // Run the testbench; a failing test fails the simulation
+    bool result = testbench->run();
 
     // finalize the design
     delete testbench;
@@ -87,7 +87,7 @@ int main(int argc, char** argv)
     // Close the log
     cLog::getInstance()->close();
 
-    return 0;
+    return result ? 0 : 1;
 }
 
 /**
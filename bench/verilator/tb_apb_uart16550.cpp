@@ -53,8 +53,20 @@ cAPBUart16550TestBench::cAPBUart16550TestBench(VerilatedContext* context, bool t
     const svScope scope = svGetScopeFromName("TOP.apb_uart16550");
     svSetScope(scope);
 
-    //define new clock
-    pclk = addClock(_core->PCLK, 10.0_ns);       // 100MHz clock
+    //define new clocks
+    pclkPeriod = 10.0_ns;
+    pclk = addClock(_core->PCLK, pclkPeriod);    // 100MHz clock
+    uclk = addClock(_core->uart_clk_i, 6.8_ns);  // ~147MHz UART clock, unrelated to PCLK
+
+    //the serial line is timed by the clock the baud generator runs on
+    clkAsync = uart16550_clk_async();
+    baudclk  = clkAsync ? uclk : pclk;
+
+    cycleCnt = 0;
+    sinTime  = 0;
+
+    //serial input is idle high
+    _core->sin_i = 1;
 
     //Hookup APB4 Bus Master
     apbMaster = new cBusAPB4 <uint8_t,uint8_t>
@@ -88,18 +100,250 @@ cAPBUart16550TestBench::~cAPBUart16550TestBench()
  */
 int cAPBUart16550TestBench::run()
 {
-    sCoRoutineHandler myTest = scratchpadTest(100);
+    bool result = true;
+
+    INFO << "UART clock: " << (clkAsync ? "uart_clk_i (asynchronous)" : "PCLK") << "\n";
+
+    result &= runTest(scratchpadTest(100));
+
+    //Back-to-back characters at each oversampling ratio with a +/-2% baud rate mismatch
+    for (int osr : {OSR16, OSR8, OSR4})
+    {
+        for (double baudMismatch : {-0.02, 0.02})
+        {
+            result &= runTest(oversamplingTest(osr, baudMismatch, 12));
+        }
+    }
+
+    //Throttle PCLK mid-stream; only meaningful when the line isn't timed by PCLK
+    if (clkAsync)
+    {
+        result &= runTest(clockDomainTest(12));
+        result &= runTest(clockDomainStreamTest(100));
+    }
+
+    //Tx FIFO low watermark interrupt at each trigger level
+    for (int txTrigger : {TX_TRIGGER00, TX_TRIGGER02, TX_TRIGGER04, TX_TRIGGER08})
+    {
+        result &= runTest(txTriggerTest(txTrigger));
+    }
+
+    //Line idle time between bursts for each Tx FIFO low watermark
+    //ISR latency in character times; a higher watermark must not increase the idle time
+    for (double isrLatency : {0.25, 3.0, 6.0})
+    {
+        size_t prevIdleCycles = ~size_t(0);
+
+        for (int txTrigger : {TX_TRIGGER00, TX_TRIGGER02, TX_TRIGGER04, TX_TRIGGER08})
+        {
+            size_t idleCycles = 0;
+
+            result &= runTest(txWatermarkTest(txTrigger, isrLatency, 64, idleCycles));
+
+            if (idleCycles > prevIdleCycles)
+            {
+                INFO << "Failed: watermark " << txWatermark(txTrigger) << " line idle " << idleCycles
+                     << " cycles, more than the lower watermark (" << prevIdleCycles << " cycles)\n";
+                result = false;
+            }
+
+            prevIdleCycles = idleCycles;
+        }
+    }
+
+    INFO << "Test result:" << result << "\n";
+
+    return result;
+}
 
-    while (!myTest)
+/**
+ * @brief Run a single test
+ * @details Ticks the testbench until the test coroutine completes
+ *
+ * @param test The coroutine handle of the test to run
+ * @return The test result
+ */
+bool cAPBUart16550TestBench::runTest(sCoRoutineHandler<bool> test)
+{
+    while (!test)
     {
         tick();
     }
 
     tick();
 
-    INFO << "Test result:" << myTest.getValue() << "\n";
+    return test.getValue();
+}
+
+/**
+ * @brief Tx FIFO low watermark
+ *
+ * @param txTrigger Tx trigger level; TX_TRIGGER00 (THRE), 02, 04, or 08
+ * @return Number of characters in the Tx FIFO at or below which the interrupt is set
+ */
+size_t cAPBUart16550TestBench::txWatermark(uint8_t txTrigger)
+{
+    switch (txTrigger & TX_TRIGGER)
+    {
+        case TX_TRIGGER02: return 2;
+        case TX_TRIGGER04: return 4;
+        case TX_TRIGGER08: return 8;
+        default          : return 0;
+    }
+}
+
+/**
+ * @brief Wait for a number of baud clock cycles
+ * @details Also advances cycleCnt, which is used to time the serial line.
+ * The baud clock is uart_clk_i when UART_CLK_ASYNC=1, PCLK otherwise.
+ *
+ * @param cycles Number of baudclk cycles to wait
+ */
+void cAPBUart16550TestBench::waitCycles(size_t cycles)
+{
+    for (size_t i = 0; i < cycles; i++)
+    {
+        waitPosEdge(baudclk);
+        cycleCnt++;
+    }
+}
+
+/**
+ * @brief Wait until cycleCnt reaches the (rounded) given cycle
+ *
+ * @param cycle baudclk cycle to wait for
+ */
+void cAPBUart16550TestBench::waitUntil(double cycle)
+{
+    while (cycleCnt < static_cast<size_t>(std::lround(cycle)))
+    {
+        waitCycles(1);
+    }
+}
+
+/**
+ * @brief Drive a character onto sin_i
+ * @details Drives an 8N1 frame, starting at sinTime. Advances sinTime to the
+ * end of the stop bit, so consecutive calls drive back-to-back characters.
+ *
+ * @param data      Character to drive
+ * @param bitCycles Bit time in baudclk cycles
+ */
+void cAPBUart16550TestBench::sinTransmit(uint8_t data, double bitCycles)
+{
+    //start bit, 8 databits (LSB first), stop bit
+    uint16_t frame = (1 << 9) | (data << 1);
+
+    for (unsigned bit = 0; bit < 10; bit++)
+    {
+        waitUntil(sinTime + bit * bitCycles);
+        _core->sin_i = (frame >> bit) & 1;
+    }
+
+    sinTime += 10 * bitCycles;
+}
+
+/**
+ * @brief Receive a character from sout_o
+ * @details Waits for a start bit, then samples sout_o in the middle of each bit
+ *
+ * @param data       Received character
+ * @param bitCycles  Bit time in baudclk cycles
+ * @param startCycle cycleCnt at the start bit
+ * @return true if a valid 8N1 frame was received
+ */
+bool cAPBUart16550TestBench::soutReceive(uint8_t& data, double bitCycles, size_t& startCycle)
+{
+    const size_t timeout = cycleCnt + std::lround(20 * bitCycles);
+
+    //wait for start bit
+    while (_core->sout_o && cycleCnt < timeout)
+    {
+        waitCycles(1);
+    }
+
+    if (_core->sout_o)
+    {
+        INFO << "Failed: no start bit\n";
+        return false;
+    }
+
+    startCycle = cycleCnt;
+    data       = 0;
+
+    //sample in the middle of each bit
+    for (unsigned bit = 0; bit < 10; bit++)
+    {
+        waitUntil(startCycle + (bit + 0.5) * bitCycles);
+
+        if (bit == 0 && _core->sout_o)
+        {
+            INFO << "Failed: start bit too short\n";
+            return false;
+        }
+        else if (bit == 9 && !_core->sout_o)
+        {
+            INFO << "Failed: framing error\n";
+            return false;
+        }
+        else if (bit > 0 && bit < 9)
+        {
+            data |= _core->sout_o << (bit - 1);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Decode and compare transmitted characters
+ * @details Decodes each character from sout_o and compares it with the expected
+ * value. The characters must be transmitted back-to-back.
+ *
+ * @param data        Expected characters
+ * @param bitCycles   Testbench bit time in baudclk cycles
+ * @param charCycles  UART character time in baudclk cycles
+ * @param onCharacter Called in the stop bit of each character with its index;
+ *                    returning false fails the comparison
+ * @return true if all characters were received as expected
+ */
+bool cAPBUart16550TestBench::txCompare(const std::vector<uint8_t>& data, double bitCycles, size_t charCycles,
+                                       const std::function<bool(size_t)>& onCharacter)
+{
+    uint8_t val;
+    size_t  startCycle, prevStartCycle = 0;
+
+    cycleCnt = 0;
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        if (!soutReceive(val, bitCycles, startCycle))
+        {
+            INFO << "Failed: Tx character " << i << "\n";
+            return false;
+        }
+
+        if (val != data[i])
+        {
+            INFO << "Failed: Tx character " << i << " expected:" << std::hex << unsigned(data[i]) << " received:" << std::hex << unsigned(val) << "\n";
+            return false;
+        }
+
+        //Tx FIFO is filled, characters must be transmitted back-to-back
+        if (i > 0 && (startCycle - prevStartCycle) != charCycles)
+        {
+            INFO << "Failed: Tx character " << i << " started " << startCycle - prevStartCycle << " cycles after previous character\n";
+            return false;
+        }
+
+        if (onCharacter && !onCharacter(i))
+        {
+            return false;
+        }
+
+        prevStartCycle = startCycle;
+    }
 
-    return myTest.getValue();
+    return true;
 }
 
 /**
@@ -210,6 +454,672 @@ sCoRoutineHandler<bool> cAPBUart16550TestBench::scratchpadTest (size_t runs)
     co_return result;
 }
 
+/**
+ * @brief Program the Divisor Latch
+ * @details Sets DLAB, writes DLM and DLL, and clears DLAB again.
+ * The Line Control Register is restored to its original value.
+ *
+ * @param divisor Divisor Latch value
+ */
+sCoRoutineHandler<bool> cAPBUart16550TestBench::setDivisor(uint16_t divisor)
+{
+    uint8_t lcr, val;
+
+    co_await apbMaster->read(LCR, &lcr);
+
+    val = lcr | DLAB;
+    co_await apbMaster->write(LCR, &val);
+
+    val = divisor >> 8;
+    co_await apbMaster->write(DLM, &val);
+
+    val = divisor & 0xff;
+    co_await apbMaster->write(DLL, &val);
+
+    co_await apbMaster->write(LCR, &lcr);
+
+    co_return true;
+}
+
+/**
+ * @brief Setup the UART for a serial line test
+ * @details Resets the UART, programs the divisor, 8N1 line format,
+ * enables and clears the FIFOs, and programs the oversampling ratio
+ *
+ * @param divisor Divisor Latch value
+ * @param osr     Oversampling ratio; OSR16, OSR8, or OSR4
+ */
+sCoRoutineHandler<bool> cAPBUart16550TestBench::setupLine(uint16_t divisor, uint8_t osr)
+{
+    uint8_t val;
+
+    _core->sin_i = 1;
+    co_await generateReset();
+
+    co_await setDivisor(divisor);
+
+    val = 0x03;                                             //8N1
+    co_await apbMaster->write(LCR, &val);
+
+    val = FIFO_ENABLE | RXFIFO_RST | TXFIFO_RST;
+    co_await apbMaster->write(FCR, &val);
+
+    val = osr;
+    co_await apbMaster->write(MCR, &val);
+
+    if (peek(PEEK_DLL) != divisor)
+    {
+        INFO << "Failed to program divisor, DLL=" << std::hex << unsigned(peek(PEEK_DLL)) << "\n";
+        co_return false;
+    }
+
+    if ((peek(PEEK_MCR) & OSR) != osr)
+    {
+        INFO << "Failed to program oversampling ratio, MCR=" << std::hex << unsigned(peek(PEEK_MCR)) << "\n";
+        co_return false;
+    }
+
+    co_return true;
+}
+
+/**
+ * @brief Read and compare received characters
+ * @details Reads each character from RBR and compares it with the expected
+ * value. LSR must flag Data Ready without any errors.
+ *
+ * @param data Expected characters
+ */
+sCoRoutineHandler<bool> cAPBUart16550TestBench::rxCompare(const std::vector<uint8_t>& data)
+{
+    uint8_t val;
+    bool    result = true;
+
+    for (size_t i = 0; (i < data.size()) && result; i++)
+    {
+        co_await apbMaster->read(LSR, &val);
+
+        if ((val & (DR | OE | PE | FE | BI)) != DR)
+        {
+            INFO << "Failed: Rx character " << i << " LSR=" << std::hex << unsigned(val) << "\n";
+            result = false;
+        }
+
+        co_await apbMaster->read(RBR, &val);
+
+        if (val != data[i])
+        {
+            INFO << "Failed: Rx character " << i << " expected:" << std::hex << unsigned(data[i]) << " received:" << std::hex << unsigned(val) << "\n";
+            result = false;
+        }
+    }
+
+    co_return result;
+}
+
+/**
+ * @brief Drain and compare received characters
+ * @details Reads RBR while LSR flags Data Ready and compares each character
+ * with the next expected value. LSR must not flag any errors.
+ *
+ * @param data     Expected characters
+ * @param received Number of characters received so far; advanced per character read
+ */
+sCoRoutineHandler<bool> cAPBUart16550TestBench::rxDrain(const std::vector<uint8_t>& data, size_t& received)
+{
+    uint8_t lsr, val;
+
+    while (true)
+    {
+        co_await apbMaster->read(LSR, &lsr);
+
+        if (lsr & (OE | PE | FE | BI))
+        {
+            INFO << "Failed: Rx character " << received << " LSR=" << std::hex << unsigned(lsr) << "\n";
+            co_return false;
+        }
+
+        if (!(lsr & DR))
+        {
+            co_return true;
+        }
+
+        co_await apbMaster->read(RBR, &val);
+
+        if (received == data.size() || val != data[received])
+        {
+            INFO << "Failed: Rx character " << received << " expected:" << std::hex << unsigned(data[received % data.size()]) << " received:" << std::hex << unsigned(val) << "\n";
+            co_return false;
+        }
+
+        received++;
+    }
+}
+
+/**
+ * @brief Fill the Tx FIFO and start transmission
+ * @details Fills the Tx FIFO while the baud generator is stopped (DL=0),
+ * then restarts the baud generator. Writing DLL is the last access, so
+ * sout_o can be decoded right after this returns.
+ * DLAB is left set; the caller must clear it.
+ *
+ * @param data    Characters to transmit
+ * @param divisor Divisor Latch value
+ */
+sCoRoutineHandler<bool> cAPBUart16550TestBench::txStart(std::vector<uint8_t>& data, uint16_t divisor)
+{
+    uint8_t val;
+
+    co_await setDivisor(0);
+
+    //let DL=0 reach the baud generator (UART_CLK_ASYNC=1) before the first character
+    for (int i = 0; i < 8; i++)
+    {
+        waitPosEdge(pclk);
+    }
+
+    for (auto& d : data)
+    {
+        co_await apbMaster->write(THR, &d);
+    }
+
+    val = 0x03 | DLAB;
+    co_await apbMaster->write(LCR, &val);
+
+    val = divisor & 0xff;
+    co_await apbMaster->write(DLL, &val);
+
+    co_return true;
+}
+
+/**
+ * @brief Oversampling test
+ * @details Transmits and receives back-to-back 8N1 characters at the selected
+ * oversampling ratio. The testbench side of the serial line runs at a baud rate
+ * that is off by baudMismatch from the UART's baud rate.
+ * Optionally PCLK is throttled halfway through each direction.
+ *
+ * Test sequence:
+ *
+ * - Program the divisor, line format, FIFOs, and oversampling ratio
+ * - Drive random characters back-to-back onto sin_i
+ * - Read the characters from the Rx FIFO and compare; LSR must not flag errors
+ * - Fill the Tx FIFO while the baud generator is stopped (DL=0)
+ * - Start the baud generator and decode sout_o in the middle of each bit
+ * - Compare the decoded characters and check they were sent back-to-back
+ *
+ * @param osr          Oversampling ratio; OSR16, OSR8, or OSR4
+ * @param baudMismatch Relative baud rate error of the testbench, e.g. 0.02 for +2%
+ * @param characters   Number of characters to transfer, must fit in the FIFO
+ * @param pclkThrottle PCLK period from halfway through each direction; 0 leaves PCLK unchanged
+ */
+sCoRoutineHandler<bool> cAPBUart16550TestBench::oversamplingTest (uint8_t osr, double baudMismatch, size_t characters, double pclkThrottle)
+{
+    const uint16_t       divisor   = 2;
+    const unsigned       ratio     = osr == OSR4 ? 4 : osr == OSR8 ? 8 : 16;
+    const double         bitCycles = divisor * ratio / (1.0 + baudMismatch);  //testbench bit time in baudclk cycles
+    std::vector<uint8_t> data(characters);
+    uint8_t              val;
+    bool                 result = true;
+
+    //throttle PCLK halfway
+    auto throttle = [&](size_t i)
+    {
+        if (pclkThrottle > 0.0 && i == characters / 2)
+        {
+            pclk->setPeriod(pclkThrottle);
+        }
+    };
+
+    INFO << "Start oversampling test: " << ratio << "x, baud mismatch " << baudMismatch * 100 << "%\n";
+
+    if (!co_await setupLine(divisor, osr))
+    {
+        co_return false;
+    }
+
+
+    /*
+     * Receive
+     */
+    for (auto& d : data) d = std::rand();
+
+    cycleCnt = 0;
+    sinTime  = 2 * bitCycles;                               //idle line
+
+    for (size_t i = 0; i < characters; i++)
+    {
+        throttle(i);
+        sinTransmit(data[i], bitCycles);
+    }
+    waitUntil(sinTime + 2 * bitCycles);
+
+    result &= co_await rxCompare(data);
+
+    pclk->setPeriod(pclkPeriod);
+
+
+    /*
+     * Transmit
+     */
+    for (auto& d : data) d = std::rand();
+
+    co_await txStart(data, divisor);
+
+    if (result)
+    {
+        result = txCompare(data, bitCycles, 10u * divisor * ratio,
+                           [&](size_t i) { throttle(i + 1); return true; });
+    }
+
+    pclk->setPeriod(pclkPeriod);
+
+    val = 0x03;
+    co_await apbMaster->write(LCR, &val);
+
+    INFO << "Oversampling test " << (result ? "passed" : "failed") << "\n";
+
+    co_return result;
+}
+
+/**
+ * @brief Clock domain test
+ * @details Runs the oversampling test at 16x while PCLK is throttled to 10MHz
+ * mid-stream. The baud generator, Tx, and Rx run on uart_clk, so neither the
+ * line rate nor the throughput may change.
+ *
+ * @param characters Number of characters to transfer, must fit in the FIFO
+ */
+sCoRoutineHandler<bool> cAPBUart16550TestBench::clockDomainTest (size_t characters)
+{
+    INFO << "Start clock domain test\n";
+
+    const bool result = co_await oversamplingTest(OSR16, 0.0, characters, 100.0_ns);
+
+    INFO << "Clock domain test " << (result ? "passed" : "failed") << "\n";
+
+    co_return result;
+}
+
+/**
+ * @brief Clock domain streaming test
+ * @details Streams characters through the UART in loopback mode (MCR.Loop) while
+ * PCLK steps up and down between frequencies, including periods where PCLK is
+ * slower than the baud tick. An interrupt service routine keeps refilling THR
+ * and draining RBR through every frequency change. The transmitter may never run
+ * empty and no character may be lost.
+ *
+ * Test sequence:
+ *
+ * - Program the divisor, line format, FIFOs, Rx trigger level, and loopback mode
+ * - Enable the Received Data Available and Transmitter Holding Register Empty Interrupts
+ * - Repeat until all characters are received:
+ *   - Step PCLK to the next period after each fifth of the characters
+ *   - Wait for the interrupt; poll after 2 character times
+ *   - Fill the Tx FIFO when LSR.THRE is set
+ *   - Drain RBR while LSR.DR is set and compare; LSR must not flag errors
+ * - Count the PCLK cycles the transmitter is empty (LSR.TEMT) while characters
+ *   remain to be sent; must be zero
+ *
+ * The Tx FIFO is refilled on THRE, while the shift register still transmits the
+ * last character. The divisor leaves that character time for the ISR, also at the
+ * slowest PCLK.
+ *
+ * @param characters Number of characters to transfer
+ */
+sCoRoutineHandler<bool> cAPBUart16550TestBench::clockDomainStreamTest (size_t characters)
+{
+    const uint16_t       divisor     = 4;
+    const size_t         fifoDepth   = 16;
+    const auto           pclkPeriods = {10.0_ns, 100.0_ns, 25.0_ns, 200.0_ns, 10.0_ns}; //baud tick is 27.2ns
+    const size_t         timeout     = 2 * 10 * divisor * 16;                        //PCLK cycles, >2 character times
+    std::vector<uint8_t> data(characters);
+    uint8_t              val, lsr;
+    size_t               sent = 0, received = 0, step = 0, stalls = 0, idleCycles = 0;
+    bool                 result = true;
+
+    INFO << "Start clock domain streaming test\n";
+
+    if (!co_await setupLine(divisor, OSR16))
+    {
+        co_return false;
+    }
+
+    val = FIFO_ENABLE | RX_TRIGGER04;
+    co_await apbMaster->write(FCR, &val);
+
+    val = LOOP | OSR16;
+    co_await apbMaster->write(MCR, &val);
+
+    val = ERBF | ETBEI;
+    co_await apbMaster->write(IER, &val);
+
+    for (auto& d : data) d = std::rand();
+
+    while (received < characters && result)
+    {
+        const size_t prevSent = sent, prevReceived = received;
+
+        //step PCLK
+        if (step < pclkPeriods.size() && received >= step * characters / pclkPeriods.size())
+        {
+            INFO << "PCLK step " << step << " after " << received << " characters\n";
+            pclk->setPeriod(pclkPeriods.begin()[step++]);
+        }
+
+        //wait for interrupt, poll after 2 characters
+        for (size_t cycles = 0; !_core->intr_o && cycles < timeout; cycles++)
+        {
+            waitPosEdge(pclk);
+            if (sent && sent < characters && (peek(PEEK_LSR) & TEMT)) idleCycles++;
+        }
+
+        //ISR; refill the Tx FIFO first, the transmitter is sending its last character
+        co_await apbMaster->read(LSR, &lsr);
+
+        if (lsr & THRE)
+        {
+            for (size_t i = 0; i < fifoDepth && sent < characters; i++)
+            {
+                co_await apbMaster->write(THR, &data[sent++]);
+            }
+
+            if (sent == characters)
+            {
+                val = ERBF;                                 //no more data to send
+                co_await apbMaster->write(IER, &val);
+            }
+        }
+
+        //ISR; drain RBR
+        result &= co_await rxDrain(data, received);
+
+        stalls = (sent != prevSent || received != prevReceived) ? 0 : stalls + 1;
+
+        if (stalls > 4)
+        {
+            INFO << "Failed: stalled after " << sent << " characters sent, " << received << " received\n";
+            result = false;
+        }
+    }
+
+    pclk->setPeriod(pclkPeriod);
+
+    if (idleCycles)
+    {
+        INFO << "Failed: transmitter ran empty for " << std::dec << idleCycles << " PCLK cycles\n";
+        result = false;
+    }
+
+    val = 0x00;
+    co_await apbMaster->write(IER, &val);
+
+    val = OSR16;
+    co_await apbMaster->write(MCR, &val);
+
+    INFO << "Clock domain streaming test " << (result ? "passed" : "failed") << "\n";
+
+    co_return result;
+}
+
+/**
+ * @brief Tx FIFO trigger level test
+ * @details Checks that the Tx FIFO low watermark interrupt is set exactly when
+ * the programmed number of characters, or less, is left in the Tx FIFO.
+ *
+ * Test sequence:
+ *
+ * - Program the divisor, line format, FIFOs, and Tx trigger level
+ * - Enable the Transmitter Holding Register Empty Interrupt; the empty Tx FIFO must set intr_o
+ * - Fill the Tx FIFO while the baud generator is stopped (DL=0); intr_o must negate
+ * - Start the baud generator and decode sout_o; compare the characters
+ * - In the stop bit of each character, the characters that didn't start yet
+ *   are in the Tx FIFO. intr_o must be set if and only if that is at or below
+ *   the watermark
+ *
+ * @param txTrigger Tx trigger level; TX_TRIGGER00 (THRE), 02, 04, or 08
+ */
+sCoRoutineHandler<bool> cAPBUart16550TestBench::txTriggerTest (uint8_t txTrigger)
+{
+    const uint16_t       divisor   = 2;
+    const size_t         fifoDepth = 16;
+    const size_t         watermark = txWatermark(txTrigger);
+    const double         bitCycles = divisor * 16;
+    std::vector<uint8_t> data(fifoDepth);
+    uint8_t              val;
+    bool                 result = true;
+
+    //in the stop bit of character i, the characters after it are in the Tx FIFO
+    auto checkInterrupt = [&](size_t i)
+    {
+        const size_t queued = fifoDepth - 1 - i;
+
+        if (_core->intr_o != (queued <= watermark))
+        {
+            INFO << "Failed: " << std::dec << queued << " characters in Tx FIFO, intr_o=" << unsigned(_core->intr_o) << "\n";
+            return false;
+        }
+
+        return true;
+    };
+
+    INFO << "Start Tx trigger test: watermark " << watermark << "\n";
+
+    if (!co_await setupLine(divisor, OSR16))
+    {
+        co_return false;
+    }
+
+    val = FIFO_ENABLE | txTrigger;
+    co_await apbMaster->write(FCR, &val);
+
+    val = ETBEI;
+    co_await apbMaster->write(IER, &val);
+
+    //allow for the clock domain crossing
+    for (int i = 0; i < 8; i++) waitPosEdge(pclk);
+
+    if (!_core->intr_o)
+    {
+        INFO << "Failed: no interrupt with empty Tx FIFO\n";
+        result = false;
+    }
+
+
+    /*
+     * Fill the Tx FIFO
+     */
+    for (auto& d : data) d = std::rand();
+
+    co_await setDivisor(0);
+
+    for (int i = 0; i < 8; i++) waitPosEdge(pclk);
+
+    for (auto& d : data)
+    {
+        co_await apbMaster->write(THR, &d);
+    }
+
+    for (int i = 0; i < 8; i++) waitPosEdge(pclk);
+
+    if (_core->intr_o)
+    {
+        INFO << "Failed: interrupt with full Tx FIFO\n";
+        result = false;
+    }
+
+
+    /*
+     * Transmit
+     */
+    val = 0x03 | DLAB;
+    co_await apbMaster->write(LCR, &val);
+
+    val = divisor & 0xff;
+    co_await apbMaster->write(DLL, &val);
+
+    if (result)
+    {
+        result = txCompare(data, bitCycles, 10u * divisor * 16, checkInterrupt);
+    }
+
+    val = 0x03;
+    co_await apbMaster->write(LCR, &val);
+
+    val = 0x00;
+    co_await apbMaster->write(IER, &val);
+
+    INFO << "Tx trigger test " << (result ? "passed" : "failed") << "\n";
+
+    co_return result;
+}
+
+/**
+ * @brief Tx FIFO low watermark test
+ * @details Measures the line idle time between bursts when the Tx FIFO is
+ * refilled by an interrupt service routine. The ISR is modelled as a fixed
+ * latency, after which it tops up the Tx FIFO to its full depth. The UART runs
+ * in loopback mode (MCR.Loop); the ISR also drains and compares the received
+ * characters.
+ *
+ * Test sequence:
+ *
+ * - Program the divisor, line format, FIFOs, Tx trigger level, and loopback mode
+ * - Enable the Transmitter Holding Register Empty Interrupt
+ * - Repeat until all characters are written:
+ *   - Wait for the interrupt
+ *   - Wait isrLatency character times
+ *   - Write (FIFO depth - watermark) characters to THR
+ *   - Drain and compare the received characters
+ * - Count the baudclk cycles the transmitter is empty (LSR.TEMT) between bursts
+ *
+ * The interrupt is set when the watermark is reached, while the shift register
+ * still transmits a character. The transmitter runs empty (watermark + 1)
+ * characters later; TEMT is set from its stop bit onwards. Therefore:
+ * - isrLatency < watermark + 0.5: the line may not go idle
+ * - isrLatency > watermark + 1.5: the line must go idle
+ * The latency and idle time are timed in baudclk cycles, the clock the
+ * transmitter runs on, so they don't depend on the PCLK to uart_clk ratio.
+ * Cycles spent in the APB accesses of the ISR aren't sampled.
+ *
+ * @param txTrigger  Tx trigger level; TX_TRIGGER00 (THRE), 02, 04, or 08
+ * @param isrLatency Interrupt latency in character times
+ * @param characters Number of characters to transmit
+ * @param idleCycles Number of baudclk cycles the transmitter was empty between bursts
+ */
+sCoRoutineHandler<bool> cAPBUart16550TestBench::txWatermarkTest (uint8_t txTrigger, double isrLatency, size_t characters, size_t& idleCycles)
+{
+    const uint16_t       divisor    = 2;
+    const size_t         fifoDepth  = 16;
+    const size_t         watermark  = txWatermark(txTrigger);
+    const size_t         charCycles = 10 * divisor * 16;                      //baudclk cycles per character
+    const size_t         latency    = std::lround(isrLatency * charCycles);
+    const size_t         timeout    = 100000;                                   //baudclk cycles
+    std::vector<uint8_t> data(characters);
+    uint8_t              val;
+    size_t               sent = 0, received = 0;
+    bool                 result = true;
+
+    INFO << "Start Tx watermark test: watermark " << watermark << ", ISR latency " << isrLatency << " characters\n";
+
+    if (!co_await setupLine(divisor, OSR16))
+    {
+        co_return false;
+    }
+
+    val = FIFO_ENABLE | txTrigger;
+    co_await apbMaster->write(FCR, &val);
+
+    val = LOOP | OSR16;
+    co_await apbMaster->write(MCR, &val);
+
+    val = ETBEI;
+    co_await apbMaster->write(IER, &val);
+
+    for (auto& d : data) d = std::rand();
+
+    idleCycles = 0;
+
+    while (sent < characters && result)
+    {
+        size_t cycles = 0;
+
+        //wait for interrupt
+        while (!_core->intr_o && cycles++ < timeout)
+        {
+            waitCycles(1);
+            if (sent && (peek(PEEK_LSR) & TEMT)) idleCycles++;
+        }
+
+        if (!_core->intr_o)
+        {
+            INFO << "Failed: no interrupt after " << sent << " characters\n";
+            result = false;
+            break;
+        }
+
+        //interrupt latency
+        for (size_t i = 0; i < latency; i++)
+        {
+            waitCycles(1);
+            if (sent && (peek(PEEK_LSR) & TEMT)) idleCycles++;
+        }
+
+        //ISR; top up the Tx FIFO
+        for (size_t i = 0; i < fifoDepth - watermark && sent < characters; i++)
+        {
+            co_await apbMaster->write(THR, &data[sent++]);
+        }
+
+        //ISR; check the looped back characters
+        result &= co_await rxDrain(data, received);
+
+        //allow the interrupt to negate
+        waitPosEdge(pclk);
+        waitPosEdge(pclk);
+    }
+
+    //wait for the last character
+    while (!(peek(PEEK_LSR) & TEMT))
+    {
+        waitCycles(1);
+    }
+
+    waitCycles(charCycles);
+
+    if (result)
+    {
+        result &= co_await rxDrain(data, received);
+    }
+
+    if (result && received != characters)
+    {
+        INFO << "Failed: received " << received << " of " << characters << " characters\n";
+        result = false;
+    }
+
+    val = 0x00;
+    co_await apbMaster->write(IER, &val);
+
+    val = OSR16;
+    co_await apbMaster->write(MCR, &val);
+
+    INFO << "Tx watermark test: watermark " << watermark << ", ISR latency " << isrLatency
+         << " characters, line idle " << idleCycles << " cycles\n";
+
+    if (isrLatency < watermark + 0.5 && idleCycles)
+    {
+        INFO << "Failed: line went idle with the ISR latency below the watermark\n";
+        result = false;
+    }
+    else if (isrLatency > watermark + 1.5 && !idleCycles)
+    {
+        INFO << "Failed: line didn't go idle with the ISR latency above the watermark\n";
+        result = false;
+    }
+
+    co_return result;
+}
+
 /**
  * @brief Wrapper function for the DPI poke function 
  *
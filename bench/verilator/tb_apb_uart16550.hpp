@@ -38,6 +38,15 @@
 //For assertions
 #include <cassert>
 
+//For std::vector
+#include <vector>
+
+//For std::lround
+#include <cmath>
+
+//For std::function
+#include <functional>
+
 //Include common routines
 #include <testbench.hpp>
 
@@ -96,6 +105,16 @@ using namespace bus;
 #define RXFIFO_RST   0x02
 #define TXFIFO_RST   0x04
 #define DMA_MODE     0x08
+#define RX_TRIGGER   0xC0
+#define RX_TRIGGER01 0x00
+#define RX_TRIGGER04 0x40
+#define RX_TRIGGER08 0x80
+#define RX_TRIGGER14 0xC0
+#define TX_TRIGGER   0x30
+#define TX_TRIGGER00 0x00
+#define TX_TRIGGER02 0x10
+#define TX_TRIGGER04 0x20
+#define TX_TRIGGER08 0x30
 
 //LCR register definitions
 #define WLS          0x03
@@ -112,6 +131,10 @@ using namespace bus;
 #define OUT1         0x04
 #define OUT2         0x08
 #define LOOP         0x10
+#define OSR          0xC0
+#define OSR16        0x00
+#define OSR8         0x40
+#define OSR4         0x80
 
 //LSR register definitions
 #define DR           0x01
@@ -162,11 +185,36 @@ class cAPBUart16550TestBench : public cTestBench<Vapb_uart16550>
 {
     private:
         cClock* pclk;
+        cClock* uclk;
+        double  pclkPeriod;                     //nominal PCLK period
+        cClock* baudclk;                        //clock the baud generator runs on; uclk or pclk
+        bool    clkAsync;                       //UART_CLK_ASYNC configuration of the DUT
         cBusAPB4<uint8_t, uint8_t>* apbMaster;
+        size_t  cycleCnt;                       //baudclk cycles, times the serial line
+        double  sinTime;                        //start of the next character on sin_i
         
         sCoRoutineHandler<bool> generateReset();
+        sCoRoutineHandler<bool> setDivisor(uint16_t divisor);
+        sCoRoutineHandler<bool> setupLine(uint16_t divisor, uint8_t osr);
+        sCoRoutineHandler<bool> rxCompare(const std::vector<uint8_t>& data);
+        sCoRoutineHandler<bool> rxDrain(const std::vector<uint8_t>& data, size_t& received);
+        sCoRoutineHandler<bool> txStart(std::vector<uint8_t>& data, uint16_t divisor);
 
         sCoRoutineHandler<bool> scratchpadTest (size_t runs);
+        sCoRoutineHandler<bool> oversamplingTest (uint8_t osr, double baudMismatch, size_t characters, double pclkThrottle = 0.0);
+        sCoRoutineHandler<bool> clockDomainTest (size_t characters);
+        sCoRoutineHandler<bool> clockDomainStreamTest (size_t characters);
+        sCoRoutineHandler<bool> txTriggerTest (uint8_t txTrigger);
+        sCoRoutineHandler<bool> txWatermarkTest (uint8_t txTrigger, double isrLatency, size_t characters, size_t& idleCycles);
+
+        bool    runTest(sCoRoutineHandler<bool> test);
+        size_t  txWatermark(uint8_t txTrigger);
+        void    waitCycles(size_t cycles);
+        void    waitUntil(double cycle);
+        void    sinTransmit(uint8_t data, double bitCycles);
+        bool    soutReceive(uint8_t& data, double bitCycles, size_t& startCycle);
+        bool    txCompare(const std::vector<uint8_t>& data, double bitCycles, size_t charCycles,
+                          const std::function<bool(size_t)>& onCharacter = nullptr);
 
         void    release(uint8_t reg);
         void    poke (uint8_t reg, uint8_t val);
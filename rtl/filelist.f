@@ -1,6 +1,9 @@
 verilog/uart16550_pkg.sv
+verilog/uart16550_sync.sv
+verilog/uart16550_baudgen.sv
 verilog/uart16550_rx.sv
 verilog/uart16550_tx.sv
 verilog/uart16550_regs.sv
 verilog/uart16550_fifo.sv
+verilog/uart16550_dcfifo.sv
 verilog/apb_uart16550.sv
@@ -52,10 +52,10 @@
 // ------------------------------------------------------------------
 // REUSE ISSUES 
 //   Reset Strategy      : external asynchronous active low; rst_ni
-//   Clock Domains       : clk_i, rising edge
+//   Clock Domains       : PCLK, uart_clk_i (UART_CLK_ASYNC=1), rising edge
 //   Critical Timing     : 
 //   Test Features       : na
-//   Asynchronous I/F    : no
+//   Asynchronous I/F    : yes; sin_i
 //   Scan Methodology    : na
 //   Instantiations      : na
 //   Synthesizable (y/n) : Yes
@@ -70,9 +70,9 @@
  * 0x0  W  Transmit Holding Register  THR  Databit7 | Databit6 | Databit5 | Databit4 | Databit3 | Databit2 | Databit1 | Databit0 |
  * 0x1  RW Interrupt Enable Register  IER  0        | 0        | 0        | 0        | EDSSI    | ELSI     | ETBEI    | ERFBI    |
  * 0x2  R  Interrupt Ident Register   IIR  FIFOs En | FIFOs En | 0        | 0        | IIDbit2  | IIDbit1  | IIDbit0  | IntPend  |
- * 0x2  W  FIFO Control Register      FCR  RxTrig1  | RxTrig0  | reserved | reserved | DMA Mode | TxFIFORst| RxFIFORst| FIFO Ena |
+ * 0x2  W  FIFO Control Register      FCR  RxTrig1  | RxTrig0  | TxTrig1  | TxTrig0  | DMA Mode | TxFIFORst| RxFIFORst| FIFO Ena |
  * 0x3  RW Line Control Register      LCR  DLAB     | Set Break| StkParity| EPS      | PEN      | STB      | WLS1     | WLS0     |
- * 0x4  RW Modem Control Register     MCR  0        | 0        | 0        | Loop     | Out2     | Out1     | RTS      | DTR      |
+ * 0x4  RW Modem Control Register     MCR  OSR1     | OSR0     | 0        | Loop     | Out2     | Out1     | RTS      | DTR      |
  * 0x5  R  Line Status Register       LSR  RxFIFOErr| TEMT     | THRE     | BI       | FE       | PE       | OE       | DR       |
  * 0x6  R  Modem Status Register      MSR  DCD      | RI       | DSR      | CTS      | DDCD     | TERI     | DDSR     | DCTS     |
  * 0x7  RW Scratchpad Register        SCR  Bit7     | Bit6     | Bit5     | Bit4     | Bit3     | Bit2     | Bit1     | Bit0     |
@@ -80,6 +80,13 @@
  * DLAB=1
  * 0x0  RW Divisor Latch LSB          DLL  Bit7     | Bit6     | Bit5     | Bit4     | Bit3     | Bit2     | Bit1     | Bit0     |
  * 0x1  RW Divisor Latch MSB          DLM  Bit15    | Bit14    | Bit13    | Bit12    | Bit11    | Bit10    | Bit9     | Bit8     |
+ *
+ * UART_CLK_ASYNC=1
+ * One character at a time crosses from the Tx FIFO to the transmitter through a dual clock
+ * FIFO. That character still counts as Transmitter Holding Register/Tx FIFO content;
+ * THRE asserts when both the Tx FIFO and the dual clock FIFO are empty, TEMT when the
+ * transmit shift register is empty as well. TxFIFORst flushes the dual clock FIFO.
+ * THRE and TEMT lag the transmitter by the synchroniser delay (2-3 PCLK cycles).
  */
 
 module apb_uart16550
@@ -90,7 +97,10 @@ import uart16550_pkg::*;
   parameter [ 1:0]   WLS_RESET_VALUE =  2'b11, //8bits
   parameter          STB_RESET_VALUE =  1'b0,  //1stop bit
   parameter          PEN_RESET_VALUE =  1'b0,  //no parity
-  parameter          EPS_RESET_VALUE =  1'b0
+  parameter          EPS_RESET_VALUE =  1'b0,
+  parameter [ 1:0]   OSR_RESET_VALUE =  2'b00, //16x oversampling
+  parameter          OSR_PROGRAMMABLE = 1'b0,  //OSR fixed to OSR_RESET_VALUE
+  parameter          UART_CLK_ASYNC   = 1'b0   //Baud generator, Tx, and Rx run on PCLK
 )
 (
   input  logic       PRESETn,
@@ -104,6 +114,10 @@ import uart16550_pkg::*;
   output logic       PREADY,
   output logic       PSLVERR,
 
+/* verilator lint_off UNUSEDSIGNAL */
+  input  logic       uart_clk_i,     //Only used when UART_CLK_ASYNC=1
+/* verilator lint_on UNUSEDSIGNAL */
+
   output logic       sout_o,
   input  logic       sin_i,
   output logic       rts_no,
@@ -139,24 +153,68 @@ import uart16550_pkg::*;
   logic       apb_read;
   logic       apb_write;
 
-  csr_t       csr;
+/* verilator lint_off UNUSEDSIGNAL */
+  csr_t       csr;           //Only a few fields are used here when UART_CLK_ASYNC=1
+/* verilator lint_on UNUSEDSIGNAL */
+  dl_t        dl;
+  logic       dl_we;
 
   logic       tx_push,
               tx_pop,
               tx_empty,
+              tx_thr_empty,
               tx_sr_empty;
+  logic [3:0] tx_trigger_lvl,
+              tx_fifo_trigger_lvl;
+  logic       tx_trigger;
   logic [7:0] tx_q;
 
   logic       rx_push,
               rx_pop,
               rx_empty,
               rx_fifo_error,
+              rx_fifo_overrun,
               rx_overrun;
   logic [3:0] rx_trigger_lvl;
   logic       rx_trigger;
   rx_d_t      rx_d,
               rx_q;
 
+  //UART clock domain
+  logic       uart_clk,
+              uart_rst_n;
+  csr_t       uart_csr;
+  dl_t        uart_dl;
+  logic       uart_dl_ld;
+  logic       uart_sin;
+
+  logic       uart_tx_pop,
+              uart_tx_empty,
+              uart_tx_sr_empty;
+  logic       uart_sout;
+  logic [7:0] uart_tx_q;
+
+  logic       uart_rx_sin;
+
+  logic       uart_rx_push;
+  rx_d_t      uart_rx_d;
+
+
+  //////////////////////////////////////////////////////////////////
+  //
+  // Functions
+  //
+  `ifdef VERILATOR
+    /**
+    * @brief DPI function to get the UART clock configuration
+    * @details Returns 1 when the baud generator, Tx, and Rx run on uart_clk_i
+    */
+    export "DPI-C" function uart16550_clk_async;
+    function byte uart16550_clk_async();
+        return {7'h0, UART_CLK_ASYNC != 0};
+    endfunction
+  `endif
+
 
   //////////////////////////////////////////////////////////////////
   //
@@ -185,7 +243,9 @@ import uart16550_pkg::*;
     .WLS_RESET_VALUE  ( WLS_RESET_VALUE ),
     .STB_RESET_VALUE  ( STB_RESET_VALUE ),
     .PEN_RESET_VALUE  ( PEN_RESET_VALUE ),
-    .EPS_RESET_VALUE  ( EPS_RESET_VALUE ) )
+    .EPS_RESET_VALUE  ( EPS_RESET_VALUE ),
+    .OSR_RESET_VALUE  ( OSR_RESET_VALUE ),
+    .OSR_PROGRAMMABLE ( OSR_PROGRAMMABLE) )
   regs (
     .rst_ni           ( PRESETn         ),
     .clk_i            ( PCLK            ),
@@ -198,7 +258,8 @@ import uart16550_pkg::*;
 
     .csr_o            ( csr             ),
 
-    .baudout_o        ( baudout_no      ),
+    .dl_o             ( dl              ),
+    .dl_we_o          ( dl_we           ),
     .rts_no           ( rts_no          ),
     .cts_ni           ( cts_ni          ),
     .dtr_no           ( dtr_no          ),
@@ -215,9 +276,11 @@ import uart16550_pkg::*;
     .irq_o            ( intr_o          ),
 
     //Tx signals
-    .tx_empty_i       ( tx_empty        ),
+    .tx_empty_i       ( tx_thr_empty    ),
     .tx_push_o        ( tx_push         ),
     .tx_sr_empty_i    ( tx_sr_empty     ),
+    .tx_trigger_lvl_o ( tx_trigger_lvl  ),
+    .tx_trigger_i     ( tx_trigger      ),
 
     //Rx signals
     .rx_empty_i       ( rx_empty        ),
@@ -233,27 +296,347 @@ import uart16550_pkg::*;
    * Hookup Tx FIFO
    */
   uart16550_fifo #(
-    .DATA_WIDTH    ( 8              ),
-    .FIFO_DEPTH    ( FIFO_DEPTH     ))
+    .DATA_WIDTH    ( 8                   ),
+    .FIFO_DEPTH    ( FIFO_DEPTH          ))
   tx_fifo (
-    .rst_ni        ( PRESETn        ),
-    .clk_i         ( PCLK           ),
+    .rst_ni        ( PRESETn             ),
+    .clk_i         ( PCLK                ),
 
-    .rst_i         ( csr.fcr.tx_rst ),
-    .ena_i         ( csr.fcr.ena    ),
-    .push_i        ( tx_push        ),
-    .pop_i         ( tx_pop         ),
+    .rst_i         ( csr.fcr.tx_rst      ),
+    .ena_i         ( csr.fcr.ena         ),
+    .push_i        ( tx_push             ),
+    .pop_i         ( tx_pop              ),
 
-    .d_i           ( PWDATA         ),
-    .q_o           ( tx_q           ),
-    .error_o       (                ),
+    .d_i           ( PWDATA              ),
+    .q_o           ( tx_q                ),
+    .error_o       (                     ),
 
-    .empty_o       ( tx_empty       ),
-    .full_o        (                ),
-    .underrun_o    (                ),
-    .overrun_o     (                ),
-    .trigger_lvl_i ( 4'h0           ),
-    .trigger_o     (                ));
+    .empty_o       ( tx_empty            ),
+    .full_o        (                     ),
+    .underrun_o    (                     ),
+    .overrun_o     (                     ),
+    .trigger_lvl_i ( tx_fifo_trigger_lvl ),
+    .trigger_o     ( tx_trigger          ));
+
+
+  /*
+   * UART clock domain
+   *
+   * UART_CLK_ASYNC=0: baud generator, Tx, and Rx run on PCLK
+   * UART_CLK_ASYNC=1: baud generator, Tx, and Rx run on uart_clk_i
+   *                   The line rate doesn't depend on PCLK, allowing PCLK
+   *                   to be throttled without reprogramming the Divisor Latch
+   *                   Data crosses between the FIFOs and Tx/Rx through dual
+   *                   clock FIFOs. LCR, OSR, Loop, and the Divisor Latch cross
+   *                   as a whole through a request/acknowledge handshake.
+   */
+generate
+  if (UART_CLK_ASYNC)
+  begin : gen_uart_clk_async
+      localparam [10:0] CFG_RESET_VALUE = {3'h0,EPS_RESET_VALUE,PEN_RESET_VALUE,
+                                           STB_RESET_VALUE,WLS_RESET_VALUE,OSR_RESET_VALUE,1'b0};
+
+      logic [10:0] cfg,
+                   cfg_dly;
+      logic       cfg_pending,
+                  cfg_pending_ld,
+                  cfg_req,
+                  cfg_ack,
+                  cfg_busy;
+      logic [27:0] cfg_hold;
+      logic [10:0] uart_cfg;
+      logic       uart_cfg_req,
+                  uart_cfg_ack;
+      logic       tx_cdc_empty,
+                  tx_sr_empty_sync,
+                  tx_flush_req,
+                  tx_flush_ack_sync,
+                  tx_flush_busy;
+      logic       uart_tx_cdc_pop,
+                  uart_tx_cdc_empty,
+                  uart_tx_flush_req,
+                  uart_tx_flush_ack,
+                  uart_tx_flush;
+      logic [1:0] uart_tx_flush_dly;
+      logic       rx_cdc_empty,
+                  rx_ovf_req,
+                  rx_ovf_ack;
+      logic       uart_rx_full,
+                  uart_rx_ovf_req,
+                  uart_rx_ovf_ack;
+
+
+      assign uart_clk = uart_clk_i;
+
+
+      //Reset synchroniser; asynchronous assert, synchronous negate
+      uart16550_sync #(
+        .WIDTH  ( 1          ))
+      rst_sync (
+        .rst_ni ( PRESETn    ),
+        .clk_i  ( uart_clk   ),
+        .d_i    ( 1'b1       ),
+        .q_o    ( uart_rst_n ));
+
+
+      //Configuration registers (Divisor Latch, LCR, OSR, Loop)
+      //Request/acknowledge handshake. The PCLK side captures the registers into
+      //a holding register, which is stable while the request is pending. The
+      //uart_clk side copies it when it sees the (synchronised) request toggle.
+      //Writes during a pending request are sent once it is acknowledged.
+      always @(posedge PCLK, negedge PRESETn)
+        if (!PRESETn)
+        begin
+            cfg_dly        <= CFG_RESET_VALUE;
+            cfg_pending    <= 1'b0;
+            cfg_pending_ld <= 1'b0;
+            cfg_req        <= 1'b0;
+            cfg_hold       <= {1'b0, DL_RESET_VALUE, CFG_RESET_VALUE};
+        end
+        else
+        begin
+            cfg_dly <= cfg;
+
+            if (cfg_pending && !cfg_busy)
+            begin
+                cfg_hold       <= {cfg_pending_ld, dl, cfg};
+                cfg_req        <= ~cfg_req;
+                cfg_pending    <= 1'b0;
+                cfg_pending_ld <= 1'b0;
+            end
+
+            //dl_we is asserted during the write; dl holds the new value next cycle
+            if (dl_we || cfg != cfg_dly) cfg_pending    <= 1'b1;
+            if (dl_we                  ) cfg_pending_ld <= 1'b1;
+        end
+
+      assign cfg      = {csr.lcr, csr.mcr.osr, csr.mcr.loop};
+      assign cfg_busy = cfg_req ^ cfg_ack;
+
+      uart16550_sync #(
+        .WIDTH  ( 1            ))
+      cfg_req_sync (
+        .rst_ni ( uart_rst_n   ),
+        .clk_i  ( uart_clk     ),
+        .d_i    ( cfg_req      ),
+        .q_o    ( uart_cfg_req ));
+
+      always @(posedge uart_clk, negedge uart_rst_n)
+        if (!uart_rst_n)
+        begin
+            uart_cfg_ack <= 1'b0;
+            uart_dl_ld   <= 1'b0;
+            uart_dl      <= DL_RESET_VALUE;
+            uart_cfg     <= CFG_RESET_VALUE;
+        end
+        else
+        begin
+            uart_cfg_ack <= uart_cfg_req;
+
+            //Only reload the baud counter when the Divisor Latch was written
+            if (uart_cfg_req ^ uart_cfg_ack) {uart_dl_ld, uart_dl, uart_cfg} <= cfg_hold;
+            else                              uart_dl_ld                      <= 1'b0;
+        end
+
+      uart16550_sync #(
+        .WIDTH  ( 1            ))
+      cfg_ack_sync (
+        .rst_ni ( PRESETn      ),
+        .clk_i  ( PCLK         ),
+        .d_i    ( uart_cfg_ack ),
+        .q_o    ( cfg_ack      ));
+
+      //Only LCR, OSR, and Loop are used in the UART clock domain
+      always_comb
+      begin
+          uart_csr.ier = 8'h00;
+          uart_csr.iir = 8'h00;
+          uart_csr.fcr = 8'h00;
+          uart_csr.lcr = uart_cfg[10:3];
+          uart_csr.lsr = 8'h00;
+          uart_csr.mcr = {uart_cfg[2:1], 1'b0, uart_cfg[0], 4'h0};
+          uart_csr.msr = 8'h00;
+          uart_csr.scr = 8'h00;
+      end
+
+
+      //Tx FIFO -> Tx
+      //The dual clock FIFO holds at most one character; the next character is
+      //only moved after the transmitter took the previous one.
+      //With FIFOs disabled the character is only moved when the shift register is
+      //empty as well, keeping the Transmitter Holding Register a single character.
+      assign tx_pop = ~tx_empty & tx_cdc_empty & ~tx_flush_busy & ~csr.fcr.tx_rst &
+                      (csr.fcr.ena | tx_sr_empty_sync);
+
+      uart16550_dcfifo #(
+        .DATA_WIDTH ( 8                 ))
+      tx_cdc (
+        .wrst_ni    ( PRESETn           ),
+        .wclk_i     ( PCLK              ),
+        .push_i     ( tx_pop            ),
+        .d_i        ( tx_q              ),
+        .full_o     (                   ),
+        .wr_empty_o ( tx_cdc_empty      ),
+
+        .rrst_ni    ( uart_rst_n        ),
+        .rclk_i     ( uart_clk          ),
+        .pop_i      ( uart_tx_cdc_pop   ),
+        .q_o        ( uart_tx_q         ),
+        .empty_o    ( uart_tx_cdc_empty ));
+
+      assign uart_tx_empty   = uart_tx_cdc_empty | uart_tx_flush;
+      assign uart_tx_cdc_pop = uart_tx_pop | (uart_tx_flush & uart_tx_flush_dly[1]);
+
+
+      //Tx FIFO reset flushes the dual clock FIFO
+      //Request/acknowledge handshake; no characters are moved while the flush is pending
+      always @(posedge PCLK, negedge PRESETn)
+        if      (!PRESETn                         ) tx_flush_req <= 1'b0;
+        else if ( csr.fcr.tx_rst && !tx_flush_busy) tx_flush_req <= ~tx_flush_req;
+
+      assign tx_flush_busy = tx_flush_req ^ tx_flush_ack_sync;
+
+      uart16550_sync #(
+        .WIDTH  ( 1                 ))
+      tx_flush_req_sync (
+        .rst_ni ( uart_rst_n        ),
+        .clk_i  ( uart_clk          ),
+        .d_i    ( tx_flush_req      ),
+        .q_o    ( uart_tx_flush_req ));
+
+      assign uart_tx_flush = uart_tx_flush_req ^ uart_tx_flush_ack;
+
+      //The write pointer may arrive up to 1 cycle after the request; wait for it
+      //to propagate into empty_o before popping/acknowledging
+      always @(posedge uart_clk, negedge uart_rst_n)
+        if (!uart_rst_n)
+        begin
+            uart_tx_flush_dly <= 2'b00;
+            uart_tx_flush_ack <= 1'b0;
+        end
+        else
+        begin
+            uart_tx_flush_dly <= {uart_tx_flush_dly[0], uart_tx_flush};
+
+            if (uart_tx_flush && uart_tx_flush_dly[1] && uart_tx_cdc_empty)
+              uart_tx_flush_ack <= uart_tx_flush_req;
+        end
+
+      uart16550_sync #(
+        .WIDTH  ( 1                 ))
+      tx_flush_ack_sync_inst (
+        .rst_ni ( PRESETn           ),
+        .clk_i  ( PCLK              ),
+        .d_i    ( uart_tx_flush_ack ),
+        .q_o    ( tx_flush_ack_sync ));
+
+
+      //The character in the dual clock FIFO is part of the Transmitter Holding Register
+      assign tx_thr_empty = tx_empty & tx_cdc_empty;
+
+      //and counts towards the Tx FIFO low watermark; lower the Tx FIFO trigger level
+      //by one while (or from the next cycle onwards) it holds a character
+      assign tx_fifo_trigger_lvl = ~|tx_trigger_lvl ? 4'h0
+                                                    : tx_trigger_lvl - {3'h0, ~tx_cdc_empty | tx_pop};
+
+      //Transmitter is empty when both the dual clock FIFO and shift register are empty
+      uart16550_sync #(
+        .WIDTH       ( 1                ),
+        .RESET_VALUE ( 1'b1             ))
+      tx_sr_empty_sync_inst (
+        .rst_ni      ( PRESETn          ),
+        .clk_i       ( PCLK             ),
+        .d_i         ( uart_tx_sr_empty ),
+        .q_o         ( tx_sr_empty_sync ));
+
+      assign tx_sr_empty = tx_sr_empty_sync & tx_cdc_empty;
+
+
+      //Rx -> Rx FIFO
+      //Move data into the Rx FIFO as soon as it's available
+      uart16550_dcfifo #(
+        .DATA_WIDTH ( $bits(rx_d_t) ))
+      rx_cdc (
+        .wrst_ni    ( uart_rst_n    ),
+        .wclk_i     ( uart_clk      ),
+        .push_i     ( uart_rx_push  ),
+        .d_i        ( uart_rx_d     ),
+        .full_o     ( uart_rx_full  ),
+        .wr_empty_o (               ),
+
+        .rrst_ni    ( PRESETn       ),
+        .rclk_i     ( PCLK          ),
+        .pop_i      ( rx_push       ),
+        .q_o        ( rx_d          ),
+        .empty_o    ( rx_cdc_empty  ));
+
+      assign rx_push = ~rx_cdc_empty;
+
+
+      //The dual clock FIFO overflows when PCLK is too slow to keep up with the
+      //line rate. Report the dropped character as an overrun error.
+      //4-phase handshake; overflows while the handshake is busy are merged
+      always @(posedge uart_clk, negedge uart_rst_n)
+        if      (!uart_rst_n                          ) uart_rx_ovf_req <= 1'b0;
+        else if ( uart_rx_ovf_ack                     ) uart_rx_ovf_req <= 1'b0;
+        else if ( uart_rx_push && uart_rx_full        ) uart_rx_ovf_req <= 1'b1;
+
+      uart16550_sync #(
+        .WIDTH  ( 1               ))
+      rx_ovf_req_sync (
+        .rst_ni ( PRESETn         ),
+        .clk_i  ( PCLK            ),
+        .d_i    ( uart_rx_ovf_req ),
+        .q_o    ( rx_ovf_req      ));
+
+      always @(posedge PCLK, negedge PRESETn)
+        if (!PRESETn) rx_ovf_ack <= 1'b0;
+        else          rx_ovf_ack <= rx_ovf_req;
+
+      uart16550_sync #(
+        .WIDTH  ( 1               ))
+      rx_ovf_ack_sync (
+        .rst_ni ( uart_rst_n      ),
+        .clk_i  ( uart_clk        ),
+        .d_i    ( rx_ovf_ack      ),
+        .q_o    ( uart_rx_ovf_ack ));
+
+      //single cycle pulse per overflow; the registers detect the rising edge
+      assign rx_overrun = rx_fifo_overrun | (rx_ovf_req & ~rx_ovf_ack);
+  end
+  else
+  begin : gen_uart_clk_pclk
+      assign uart_clk            = PCLK;
+      assign uart_rst_n          = PRESETn;
+      assign uart_csr            = csr;
+      assign uart_dl             = dl;
+      assign uart_dl_ld          = dl_we;
+
+      assign tx_pop              = uart_tx_pop;
+      assign tx_thr_empty        = tx_empty;
+      assign tx_fifo_trigger_lvl = tx_trigger_lvl;
+      assign uart_tx_empty       = csr.lsr.thre;
+      assign uart_tx_q           = tx_q;
+      assign tx_sr_empty         = uart_tx_sr_empty;
+
+      assign rx_push             = uart_rx_push;
+      assign rx_d                = uart_rx_d;
+      assign rx_overrun          = rx_fifo_overrun;
+  end
+endgenerate
+
+
+  /*
+   * Hookup Baud Generator
+   */
+  uart16550_baudgen
+  baudgen (
+    .rst_ni    ( uart_rst_n ),
+    .clk_i     ( uart_clk   ),
+
+    .dl_i      ( uart_dl    ),
+    .ld_i      ( uart_dl_ld ),
+    .baudout_o ( baudout_no ));
 
 
   /*
@@ -261,15 +644,29 @@ import uart16550_pkg::*;
    */
   uart16550_tx
   tx (
-    .rst_ni     ( PRESETn     ),
-    .clk_i      ( PCLK        ),
+    .rst_ni     ( uart_rst_n       ),
+    .clk_i      ( uart_clk         ),
 
-    .baudout_i  ( baudout_no  ),
-    .csr_i      ( csr         ),
-    .pop_o      ( tx_pop      ),
-    .d_i        ( tx_q        ),
-    .sr_empty_o ( tx_sr_empty ),
-    .sout_o     ( sout_o      ));
+    .baudout_i  ( baudout_no       ),
+    .csr_i      ( uart_csr         ),
+    .empty_i    ( uart_tx_empty    ),
+    .pop_o      ( uart_tx_pop      ),
+    .d_i        ( uart_tx_q        ),
+    .sr_empty_o ( uart_tx_sr_empty ),
+    .sout_o     ( uart_sout        ));
+
+
+  /*
+   * Synchronise SIN
+   */
+  uart16550_sync #(
+    .WIDTH       ( 1          ),
+    .RESET_VALUE ( 1'b1       ))
+  sin_sync (
+    .rst_ni      ( uart_rst_n ),
+    .clk_i       ( uart_clk   ),
+    .d_i         ( sin_i      ),
+    .q_o         ( uart_sin   ));
 
 
   /*
@@ -277,14 +674,23 @@ import uart16550_pkg::*;
    */
   uart16550_rx
   rx (
-    .rst_ni    ( PRESETn    ),
-    .clk_i     ( PCLK       ),
+    .rst_ni    ( uart_rst_n   ),
+    .clk_i     ( uart_clk     ),
 
-    .baudout_i ( baudout_no ),
-    .csr_i     ( csr        ),
-    .push_o    ( rx_push    ),
-    .q_o       ( rx_d       ),
-    .sin_i     ( sin_i      )); //TODO: SIN needs to be synchronised
+    .baudout_i ( baudout_no   ),
+    .csr_i     ( uart_csr     ),
+    .push_o    ( uart_rx_push ),
+    .q_o       ( uart_rx_d    ),
+    .sin_i     ( uart_rx_sin  ));
+
+
+  /*
+   * Loop mode (MCR.Loop)
+   * The transmitter output is looped back to the receiver input, sin_i is
+   * disconnected and sout_o is held marking (1)
+   */
+  assign sout_o      = uart_sout | uart_csr.mcr.loop;
+  assign uart_rx_sin = uart_csr.mcr.loop ? uart_sout : uart_sin;
 
 
   /*
@@ -309,7 +715,7 @@ import uart16550_pkg::*;
     .empty_o       ( rx_empty       ),
     .full_o        (                ),
     .underrun_o    (                ),
-    .overrun_o     ( rx_overrun     ),
+    .overrun_o     ( rx_fifo_overrun),
     .trigger_lvl_i ( rx_trigger_lvl ),
     .trigger_o     ( rx_trigger     ));
 
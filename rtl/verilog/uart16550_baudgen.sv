@@ -0,0 +1,116 @@
+/////////////////////////////////////////////////////////////////////
+//   ,------.                    ,--.                ,--.          //
+//   |  .--. ' ,---.  ,--,--.    |  |    ,---. ,---. `--' ,---.    //
+//   |  '--'.'| .-. |' ,-.  |    |  |   | .-. | .-. |,--.| .--'    //
+//   |  |\  \ ' '-' '\ '-'  |    |  '--.' '-' ' '-' ||  |\ `--.    //
+//   `--' '--' `---'  `--`--'    `-----' `---' `-   /`--' `---'    //
+//                                             `---'               //
+//    UART16550 Baud Generator Module                              //
+//                                                                 //
+/////////////////////////////////////////////////////////////////////
+//                                                                 //
+//             Copyright (C) 2024 Roa Logic BV                     //
+//             www.roalogic.com                                    //
+//                                                                 //
+//   This source file may be used and distributed without          //
+//   restriction provided that this copyright statement is not     //
+//   removed from the file and that any derivative work contains   //
+//   the original copyright notice and the associated disclaimer.  //
+//                                                                 //
+//      THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY        //
+//   EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED     //
+//   TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS     //
+//   FOR A PARTICULAR PURPOSE. IN NO EVENT SHALL THE AUTHOR OR     //
+//   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,  //
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT  //
+//   NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;  //
+//   LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)      //
+//   HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN     //
+//   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR  //
+//   OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS          //
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  //
+//                                                                 //
+/////////////////////////////////////////////////////////////////////
+
+// +FHDR -  Semiconductor Reuse Standard File Header Section  -------
+// FILE NAME      : uart16550_baudgen.sv
+// DEPARTMENT     :
+// AUTHOR         : roalogic
+// AUTHOR'S EMAIL :
+// ------------------------------------------------------------------
+// RELEASE HISTORY
+// VERSION DATE        AUTHOR      DESCRIPTION
+// 1.0     2026-10-19  roalogic    initial release
+// ------------------------------------------------------------------
+// KEYWORDS : AMBA APB4 16550 compatible UART     
+// ------------------------------------------------------------------
+// PURPOSE  : UART 16550
+// ------------------------------------------------------------------
+// PARAMETERS
+//  PARAM NAME        RANGE    DESCRIPTION              DEFAULT UNITS
+//
+// ------------------------------------------------------------------
+// REUSE ISSUES 
+//   Reset Strategy      : external asynchronous active low; rst_ni
+//   Clock Domains       : clk_i, rising edge
+//   Critical Timing     : 
+//   Test Features       : na
+//   Asynchronous I/F    : no
+//   Scan Methodology    : na
+//   Instantiations      : na
+//   Synthesizable (y/n) : Yes
+//   Other               :                                         
+
+
+
+/*
+ * Baud Generator
+ *
+ * The 16550 outputs a 16x 50/50 clock used as baudclock
+ * The IP generates a 16x (or 8x/4x, see OSR) clock enable signal instead
+ */
+module uart16550_baudgen
+import uart16550_pkg::*;
+(
+  input  logic rst_ni,
+  input  logic clk_i,
+
+  input  dl_t  dl_i,       //Divisor Latch
+  input  logic ld_i,       //(Re)load baud counter
+
+  output logic baudout_o
+);
+
+  //////////////////////////////////////////////////////////////////
+  //
+  // Variables
+  //
+  logic [15:0] baud_cnt;    //baudout counter
+  logic        ld_baud_cnt;
+
+
+  //////////////////////////////////////////////////////////////////
+  //
+  // Module Body
+  //
+
+  //Load baud counter when either of the Divisor Latch register are loaded (written to)
+  //Use a register as a delay. Ensure dl_i is actually loaded before taking over the new value
+  always @(posedge clk_i)
+    ld_baud_cnt <= ld_i;
+
+
+  //generate baud counter
+  always @(posedge clk_i, negedge rst_ni)
+    if (!rst_ni)
+      baud_cnt  <= 16'h0;
+    else if (ld_baud_cnt || ~|baud_cnt)
+      baud_cnt <= dl_i -1;
+    else
+      baud_cnt <= baud_cnt -1;
+
+  //generate baudout
+  always @(posedge clk_i)
+    baudout_o <= |dl_i & ~|baud_cnt;
+
+endmodule
@@ -0,0 +1,223 @@
+/////////////////////////////////////////////////////////////////////
+//   ,------.                    ,--.                ,--.          //
+//   |  .--. ' ,---.  ,--,--.    |  |    ,---. ,---. `--' ,---.    //
+//   |  '--'.'| .-. |' ,-.  |    |  |   | .-. | .-. |,--.| .--'    //
+//   |  |\  \ ' '-' '\ '-'  |    |  '--.' '-' ' '-' ||  |\ `--.    //
+//   `--' '--' `---'  `--`--'    `-----' `---' `-   /`--' `---'    //
+//                                             `---'               //
+//    UART16550 Dual Clock FIFO Module                             //
+//                                                                 //
+/////////////////////////////////////////////////////////////////////
+//                                                                 //
+//             Copyright (C) 2024 Roa Logic BV                     //
+//             www.roalogic.com                                    //
+//                                                                 //
+//   This source file may be used and distributed without          //
+//   restriction provided that this copyright statement is not     //
+//   removed from the file and that any derivative work contains   //
+//   the original copyright notice and the associated disclaimer.  //
+//                                                                 //
+//      THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY        //
+//   EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED     //
+//   TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS     //
+//   FOR A PARTICULAR PURPOSE. IN NO EVENT SHALL THE AUTHOR OR     //
+//   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,  //
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT  //
+//   NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;  //
+//   LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)      //
+//   HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN     //
+//   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR  //
+//   OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS          //
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  //
+//                                                                 //
+/////////////////////////////////////////////////////////////////////
+
+// +FHDR -  Semiconductor Reuse Standard File Header Section  -------
+// FILE NAME      : uart16550_dcfifo.sv
+// DEPARTMENT     :
+// AUTHOR         : roalogic
+// AUTHOR'S EMAIL :
+// ------------------------------------------------------------------
+// RELEASE HISTORY
+// VERSION DATE        AUTHOR      DESCRIPTION
+// 1.0     2026-10-19  roalogic    initial release
+// ------------------------------------------------------------------
+// KEYWORDS : AMBA APB4 16550 compatible UART     
+// ------------------------------------------------------------------
+// PURPOSE  : UART 16550
+// ------------------------------------------------------------------
+// PARAMETERS
+//  PARAM NAME        RANGE    DESCRIPTION              DEFAULT UNITS
+//
+// ------------------------------------------------------------------
+// REUSE ISSUES 
+//   Reset Strategy      : external asynchronous active low; wrst_ni, rrst_ni
+//   Clock Domains       : wclk_i, rclk_i, rising edge
+//   Critical Timing     : 
+//   Test Features       : na
+//   Asynchronous I/F    : yes; write/read pointers
+//   Scan Methodology    : na
+//   Instantiations      : uart16550_sync
+//   Synthesizable (y/n) : Yes
+//   Other               :                                         
+
+
+
+/*
+ * Dual clock FIFO
+ *
+ * Moves data between the APB (PCLK) and the UART (uart_clk_i) clock domains.
+ * Read and write pointers cross the clock domains Gray coded.
+ * Flags are pessimistic; full_o/wr_empty_o (write side) and empty_o (read side)
+ * only update after the other side's pointer is synchronised.
+ */
+module uart16550_dcfifo
+#(
+  parameter int DATA_WIDTH = 8,
+  parameter int FIFO_DEPTH = 4             //Must be a power of 2, minimum 4
+)
+(
+  //Write side
+  input  logic                  wrst_ni,    //Asynchronous active low reset
+  input  logic                  wclk_i,     //Write clock
+
+  input  logic                  push_i,     //Push data onto queue
+  input  logic [DATA_WIDTH-1:0] d_i,        //Data input
+  output logic                  full_o,     //FIFO is full
+  output logic                  wr_empty_o, //FIFO is empty, as seen from the write side
+
+  //Read side
+  input  logic                  rrst_ni,    //Asynchronous active low reset
+  input  logic                  rclk_i,     //Read clock
+
+  input  logic                  pop_i,      //Pop data from queue
+  output logic [DATA_WIDTH-1:0] q_o,        //Data output
+  output logic                  empty_o     //FIFO is empty
+);
+
+  //////////////////////////////////////////////////////////////////
+  //
+  // Constants
+  //
+  localparam int AW = $clog2(FIFO_DEPTH);
+
+
+  //////////////////////////////////////////////////////////////////
+  //
+  // Functions
+  //
+  function automatic logic [AW:0] bin2gray(input logic [AW:0] b);
+    return b ^ (b >> 1);
+  endfunction
+
+
+  //////////////////////////////////////////////////////////////////
+  //
+  // Variables
+  //
+  logic [DATA_WIDTH-1:0] mem_array [FIFO_DEPTH];
+
+  logic [AW          :0] wbin,  wbin_nxt,
+                         wgray, wgray_nxt,
+                         wgray_rsync;
+  logic [AW          :0] rbin,  rbin_nxt,
+                         rgray, rgray_nxt,
+                         rgray_wsync;
+
+
+  //////////////////////////////////////////////////////////////////
+  //
+  // Module Body
+  //
+
+  /*
+   * Write side
+   */
+
+  //no writing to full FIFO
+  assign wbin_nxt  = wbin + {{AW{1'b0}}, push_i & ~full_o};
+  assign wgray_nxt = bin2gray(wbin_nxt);
+
+  always @(posedge wclk_i, negedge wrst_ni)
+    if (!wrst_ni)
+    begin
+        wbin  <= 'h0;
+        wgray <= 'h0;
+    end
+    else
+    begin
+        wbin  <= wbin_nxt;
+        wgray <= wgray_nxt;
+    end
+
+
+  //Memory array
+  always @(posedge wclk_i)
+    if (push_i && !full_o) mem_array[wbin[AW-1:0]] <= d_i;
+
+
+  //Synchronise read pointer
+  uart16550_sync #(
+    .WIDTH  ( AW+1        ))
+  rgray_sync (
+    .rst_ni ( wrst_ni     ),
+    .clk_i  ( wclk_i      ),
+    .d_i    ( rgray       ),
+    .q_o    ( rgray_wsync ));
+
+
+  //Flags
+  always @(posedge wclk_i, negedge wrst_ni)
+    if (!wrst_ni)
+    begin
+        full_o     <= 1'b0;
+        wr_empty_o <= 1'b1;
+    end
+    else
+    begin
+        full_o     <= wgray_nxt == {~rgray_wsync[AW -: 2], rgray_wsync[AW-2:0]};
+        wr_empty_o <= wgray_nxt == rgray_wsync;
+    end
+
+
+  /*
+   * Read side
+   */
+
+  //no reading from empty FIFO
+  assign rbin_nxt  = rbin + {{AW{1'b0}}, pop_i & ~empty_o};
+  assign rgray_nxt = bin2gray(rbin_nxt);
+
+  always @(posedge rclk_i, negedge rrst_ni)
+    if (!rrst_ni)
+    begin
+        rbin  <= 'h0;
+        rgray <= 'h0;
+    end
+    else
+    begin
+        rbin  <= rbin_nxt;
+        rgray <= rgray_nxt;
+    end
+
+
+  //Assign output
+  assign q_o = mem_array[rbin[AW-1:0]];
+
+
+  //Synchronise write pointer
+  uart16550_sync #(
+    .WIDTH  ( AW+1        ))
+  wgray_sync (
+    .rst_ni ( rrst_ni     ),
+    .clk_i  ( rclk_i      ),
+    .d_i    ( wgray       ),
+    .q_o    ( wgray_rsync ));
+
+
+  //Flags
+  always @(posedge rclk_i, negedge rrst_ni)
+    if (!rrst_ni) empty_o <= 1'b1;
+    else          empty_o <= rgray_nxt == wgray_rsync;
+
+endmodule
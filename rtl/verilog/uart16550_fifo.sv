@@ -99,6 +99,7 @@ import uart16550_pkg::*;
   logic [DATA_WIDTH        -1:0] mem_array [FIFO_DEPTH-1:0];
   logic [FIFO_DEPTH        -2:0] error;
   logic [$clog2(FIFO_DEPTH)-1:0] wadr;
+  logic [$clog2(FIFO_DEPTH)  :0] level_nxt;
 
   logic                          push, pop;
  
@@ -135,7 +136,7 @@ import uart16550_pkg::*;
       2'b00: ;
 
       2'b01: begin
-                 for (int i=0; i < FIFO_DEPTH-2; i++)
+                 for (int i=0; i < FIFO_DEPTH-1; i++)
                    mem_array[i] <= mem_array[i+1];
 
                  mem_array[FIFO_DEPTH-1] <= 'h0;
@@ -144,7 +145,7 @@ import uart16550_pkg::*;
       2'b10: mem_array[wadr] <= d_i;
 
       2'b11: begin
-                 for (int i=0; i < FIFO_DEPTH-2; i++)
+                 for (int i=0; i < FIFO_DEPTH-1; i++)
                    mem_array[i] <= mem_array[i+1];
 
                  mem_array[FIFO_DEPTH-1] <= 'h0;
@@ -228,9 +229,17 @@ import uart16550_pkg::*;
 
 
   //trigger
+  //FIFO level after this cycle's push/pop; wadr wraps to zero when the FIFO is full
+  always_comb
+    case ({push, pop})
+      2'b01  : level_nxt = {full_o, wadr} -1;
+      2'b10  : level_nxt = {full_o, wadr} +1;
+      default: level_nxt = {full_o, wadr};
+    endcase
+
   always @(posedge clk_i, negedge rst_ni)
-    if      (!rst_ni    ) trigger_o <= 1'b0;
-    else if ( rst_i     ) trigger_o <= 1'b0;
-    else if ( push ^ pop) trigger_o <= (wadr >= trigger_lvl_i);
+    if      (!rst_ni) trigger_o <= 1'b0;
+    else if ( rst_i ) trigger_o <= 1'b0;
+    else              trigger_o <= level_nxt >= {1'b0, trigger_lvl_i};
 
 endmodule
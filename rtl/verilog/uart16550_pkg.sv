@@ -78,9 +78,17 @@ package uart16550_pkg;
 
   typedef enum logic [1:0] {rxtrigger01=2'b00, rxtrigger04=2'b01, rxtrigger08=2'b10, rxtrigger14=2'b11} rxtrigger_t;
 
+  typedef enum logic [1:0] {txtrigger00=2'b00, txtrigger02=2'b01, txtrigger04=2'b10, txtrigger08=2'b11} txtrigger_t;
+
   typedef struct packed {
     rxtrigger_t rx_trigger;        //Receive trigger
-    logic [1:0] reserved;          //reserved
+    txtrigger_t tx_trigger;        //Transmit trigger (extension)
+                                   //  00: FIFO empty (THRE)
+                                   //  01: 2 or less bytes in FIFO
+                                   //  10: 4 or less bytes in FIFO
+                                   //  11: 8 or less bytes in FIFO
+                                   //  Excludes the shift register, includes the
+                                   //  Tx clock domain crossing (UART_CLK_ASYNC=1)
     logic       dma_mode;          //DMA mode select
     logic       tx_rst;            //Transmit FIFO Reset
     logic       rx_rst;            //Receive FIFO Reset
@@ -114,8 +122,15 @@ package uart16550_pkg;
 				   //  11: 8bits
   } lcr_t; //Line Control Register
 
+  typedef enum logic [1:0] {osr16=2'b00, osr8=2'b01, osr4=2'b10} osr_t;
+
   typedef struct packed {
-    logic [2:0] zeros;             //always zero
+    osr_t       osr;               //Oversampling Ratio (extension)
+                                   //  00: 16x baudout ticks per bit
+                                   //  01:  8x baudout ticks per bit
+                                   //  10:  4x baudout ticks per bit
+                                   //  11: reserved (16x)
+    logic       zeros;             //always zero
     logic       loop;
     logic       out2;
     logic       out1;
@@ -84,9 +84,9 @@
  * 0x0  W  Transmit Holding Register  THR  Databit7 | Databit6 | Databit5 | Databit4 | Databit3 | Databit2 | Databit1 | Databit0 |
  * 0x1  RW Interrupt Enable Register  IER  0        | 0        | 0        | 0        | EDSSI    | ELSI     | ETBEI    | EFBI     |
  * 0x2  R  Interrupt Ident Register   IIR  FIFOs En | FIFOs En | 0        | 0        | IIDbit2  | IIDbit1  | IIDbit0  | IntPend  |
- * 0x2  W  FIFO Control Register      FCR  RxTrig1  | RxTrig0  | reserved | reserved | DMA Mode | TxFIFORst| RxFIFORst| FIFO Ena |
+ * 0x2  W  FIFO Control Register      FCR  RxTrig1  | RxTrig0  | TxTrig1  | TxTrig0  | DMA Mode | TxFIFORst| RxFIFORst| FIFO Ena |
  * 0x3  RW Line Control Register      LCR  DLAB     | Set Break| StkParity| EPS      | PEN      | STB      | WLS1     | WLS0     |
- * 0x4  RW Modem Control Register     MCR  0        | 0        | AFE      | Loop     | Out2     | Out1     | RTS      | DTR      |
+ * 0x4  RW Modem Control Register     MCR  OSR1     | OSR0     | AFE      | Loop     | Out2     | Out1     | RTS      | DTR      |
  * 0x5  R  Line Status Register       LSR  RxFIFOErr| TEMT     | THRE     | BI       | FE       | PE       | OE       | DR       |
  * 0x6  R  Modem Status Register      MSR  DCD      | RI       | DSR      | CTS      | DDCD     | TERI     | DDSR     | DCTS     |
  * 0x7  RW Scratchpad Register        SCR  Bit7     | Bit6     | Bit5     | Bit4     | Bit3     | Bit2     | Bit1     | Bit0     |
@@ -94,6 +94,20 @@
  * DLAB=1
  * 0x0  RW Divisor Latch LSB          DLL  Bit7     | Bit6     | Bit5     | Bit4     | Bit3     | Bit2     | Bit1     | Bit0     |
  * 0x1  RW Divisor Latch MSB          DLM  Bit15    | Bit14    | Bit13    | Bit12    | Bit11    | Bit10    | Bit9     | Bit8     |
+ *
+ * OSR (MCR[7:6]) is an extension to the 16550 register set. It selects the
+ * number of baudout ticks per bit: 00=16x (default), 01=8x, 10=4x
+ * It is only writeable when OSR_PROGRAMMABLE=1, otherwise it is fixed to OSR_RESET_VALUE
+ *
+ * Loop (MCR[4]) loops the transmitter back to the receiver. SOUT is held marking and
+ * RTS/DTR/OUT1/OUT2 are held inactive. DTR, RTS, OUT1, and OUT2 are looped back to
+ * DSR, CTS, RI, and DCD respectively; the MSR delta bits follow the looped signals.
+ *
+ * TxTrig (FCR[5:4]) is an extension to the 16550 register set. It sets the Tx FIFO
+ * low watermark for the Transmitter Holding Register Empty Interrupt:
+ * 00=FIFO empty (THRE, default), 01=2 or less, 10=4 or less, 11=8 or less bytes in the Tx FIFO
+ * The character in the transmit shift register isn't counted. With UART_CLK_ASYNC=1 the
+ * character waiting in the Tx clock domain crossing is counted as a Tx FIFO entry.
  */
 
 module uart16550_regs
@@ -103,7 +117,9 @@ import uart16550_pkg::*;
   parameter [ 1:0] WLS_RESET_VALUE =  2'b00,
   parameter        STB_RESET_VALUE =  1'b0,
   parameter        PEN_RESET_VALUE =  1'b0,
-  parameter        EPS_RESET_VALUE =  1'b0
+  parameter        EPS_RESET_VALUE =  1'b0,
+  parameter [ 1:0] OSR_RESET_VALUE =  2'b00,
+  parameter        OSR_PROGRAMMABLE = 1'b0
 )
 (
   input  logic       rst_ni,
@@ -117,7 +133,8 @@ import uart16550_pkg::*;
 
   output csr_t       csr_o,
 
-  output logic       baudout_o,
+  output dl_t        dl_o,
+  output logic       dl_we_o,
 
   output logic       rts_no,
   input  logic       cts_ni,
@@ -140,6 +157,8 @@ import uart16550_pkg::*;
   input  logic       tx_empty_i,
   output logic       tx_push_o,
   input  logic       tx_sr_empty_i,
+  output logic [3:0] tx_trigger_lvl_o,
+  input  logic       tx_trigger_i,
 
 
   //Rx status signals
@@ -239,7 +258,6 @@ import uart16550_pkg::*;
   //
   csr_t        csr;         //Control and Status registers
   dl_t         dl;          //Baud counter value
-  logic [15:0] baud_cnt;    //baudout counter
 
   logic        write_thr;   //write to Transmit Hold Register
   logic        read_rbr,
@@ -251,12 +269,17 @@ import uart16550_pkg::*;
                dfe,
                dbi;
 
-  logic        d_dcd_ni,
-               d_ri_ni,
-               d_dsr_ni,
-               d_cts_ni;
+  logic        dcd_n,       //modem status inputs, looped back in Loop mode
+               ri_n,
+               dsr_n,
+               cts_n;
 
-  logic        ld_baud_cnt;
+  logic        d_dcd_n,
+               d_ri_n,
+               d_dsr_n,
+               d_cts_n;
+
+  logic        tx_irq;      //Tx FIFO low watermark or THRE
 
   
   //////////////////////////////////////////////////////////////////
@@ -313,6 +336,7 @@ import uart16550_pkg::*;
     else if ( we_i && adr_i == FCR_ADR)
     begin
         csr.fcr.rx_trigger <= rxtrigger_t'(d_i[7:6]);
+        csr.fcr.tx_trigger <= txtrigger_t'(d_i[5:4]);
         csr.fcr.dma_mode   <= d_i[  3];
         csr.fcr.tx_rst     <= d_i[  2];
         csr.fcr.rx_rst     <= d_i[  1];
@@ -337,6 +361,19 @@ import uart16550_pkg::*;
         rxtrigger14: rx_trigger_lvl_o = 4'd14;
       endcase
 
+  //decode tx_trigger
+  //The FIFO trigger fires at or above the trigger level,
+  //the low watermark is one below the trigger level
+  always_comb
+    if (!csr.fcr.ena) tx_trigger_lvl_o = 4'd0;
+    else
+      case (csr.fcr.tx_trigger)
+        txtrigger00: tx_trigger_lvl_o = 4'd0; //THRE
+        txtrigger02: tx_trigger_lvl_o = 4'd3;
+        txtrigger04: tx_trigger_lvl_o = 4'd5;
+        txtrigger08: tx_trigger_lvl_o = 4'd9;
+      endcase
+
 
   //LCR Line Control Register
   always @(posedge clk_i, negedge rst_ni)
@@ -345,9 +382,11 @@ import uart16550_pkg::*;
 
 
   //MCR Modem Control Register
+  //Bits7:6 hold the oversampling ratio; only writeable when OSR_PROGRAMMABLE=1
   always @(posedge clk_i, negedge rst_ni)
-    if      (!rst_ni                  ) csr.mcr <= 8'h00;
-    else if ( we_i && adr_i == MCR_ADR) csr.mcr <= d_i & 8'h0F; //Bits7:4 always zero
+    if      (!rst_ni                  ) csr.mcr <= {OSR_RESET_VALUE, 6'h00};
+    else if ( we_i && adr_i == MCR_ADR) csr.mcr <= {OSR_PROGRAMMABLE ? d_i[7:6] : OSR_RESET_VALUE,
+                                                    1'b0, d_i[4:0]}; //Bit5 always zero
 
 
   //SCR Scratchpad Register
@@ -434,24 +473,33 @@ import uart16550_pkg::*;
   /*
    * Decode Modem Control Register 
    */
-  assign out2_no = ~csr.mcr.out2;
-  assign out1_no = ~csr.mcr.out1;
-  assign rts_no  = ~csr.mcr.rts;
-  assign dtr_no  = ~csr.mcr.dtr;
+  //Loop mode: modem control outputs are forced inactive (high)
+  assign out2_no = ~csr.mcr.out2 | csr.mcr.loop;
+  assign out1_no = ~csr.mcr.out1 | csr.mcr.loop;
+  assign rts_no  = ~csr.mcr.rts  | csr.mcr.loop;
+  assign dtr_no  = ~csr.mcr.dtr  | csr.mcr.loop;
 
 
 
   /*
    * Encode Modem Status Register 
    */
+
+   //Loop mode: modem control bits are looped back to the modem status inputs
+   //and the external modem status inputs are disconnected
+   assign dcd_n = csr.mcr.loop ? ~csr.mcr.out2 : dcd_ni;
+   assign ri_n  = csr.mcr.loop ? ~csr.mcr.out1 : ri_ni;
+   assign dsr_n = csr.mcr.loop ? ~csr.mcr.dtr  : dsr_ni;
+   assign cts_n = csr.mcr.loop ? ~csr.mcr.rts  : cts_ni;
+
    
    //Delay modem status inputs
    always @(posedge clk_i)
      begin
-         d_dcd_ni <= dcd_ni;
-         d_ri_ni  <= ri_ni;
-         d_dsr_ni <= dsr_ni;
-         d_cts_ni <= cts_ni;
+         d_dcd_n <= dcd_n;
+         d_ri_n  <= ri_n;
+         d_dsr_n <= dsr_n;
+         d_cts_n <= cts_n;
      end
 
 
@@ -460,25 +508,29 @@ import uart16550_pkg::*;
      if (!rst_ni) csr.msr <= 8'h00;
      else
      begin
-         csr.msr.dcd  <= csr.mcr.loop ? csr.mcr.out2 : ~dcd_ni;
-         csr.msr.ri   <= csr.mcr.loop ? csr.mcr.out1 : ~ri_ni;
-         csr.msr.dsr  <= csr.mcr.loop ? csr.mcr.dtr  : ~dsr_ni;
-         csr.msr.cts  <= csr.mcr.loop ? csr.mcr.rts  : ~cts_ni;
-         csr.msr.ddcd <= (dcd_ni ^  d_dcd_ni) | (csr.msr.ddcd & ~read_msr); //detect state change and hold
-         csr.msr.teri <= (ri_ni  & ~d_ri_ni ) | (csr.msr.teri & ~read_msr); //detect rising edge and hold
-         csr.msr.ddsr <= (dsr_ni ^  d_dsr_ni) | (csr.msr.ddsr & ~read_msr); //detect state change and hold
-         csr.msr.dcts <= (cts_ni ^  d_cts_ni) | (csr.msr.dcts & ~read_msr); //detect state change and hold
+         csr.msr.dcd  <= ~dcd_n;
+         csr.msr.ri   <= ~ri_n;
+         csr.msr.dsr  <= ~dsr_n;
+         csr.msr.cts  <= ~cts_n;
+         csr.msr.ddcd <= (dcd_n ^  d_dcd_n) | (csr.msr.ddcd & ~read_msr); //detect state change and hold
+         csr.msr.teri <= (ri_n  & ~d_ri_n ) | (csr.msr.teri & ~read_msr); //detect rising edge and hold
+         csr.msr.ddsr <= (dsr_n ^  d_dsr_n) | (csr.msr.ddsr & ~read_msr); //detect state change and hold
+         csr.msr.dcts <= (cts_n ^  d_cts_n) | (csr.msr.dcts & ~read_msr); //detect state change and hold
      end
 
 
   /*
    * Interrupt
    */
+  //Transmit Holding Register Empty Interrupt fires on the Tx FIFO low watermark
+  //when a Tx trigger level is programmed, on THRE otherwise
+  assign tx_irq = |tx_trigger_lvl_o ? ~tx_trigger_i : csr.lsr.thre;
+
   always @(posedge clk_i, negedge rst_ni)
     if (!rst_ni) irq_o <= 1'b0;
     else         irq_o <= (csr.ier.edssi & |csr.msr[3:0]) |                //Modem Status Interrupt
                           (csr.ier.elsi  & |csr.lsr[4:1]) |                //Line Status Interrupt
-                          (csr.ier.etbei &  csr.lsr.thre) |                //Transmit Holding Register Empty Interrupt
+                          (csr.ier.etbei &  tx_irq      ) |                //Transmit Holding Register Empty Interrupt
                           (csr.ier.erbi  & (csr.fcr.ena ? rx_trigger_i
                                                         : csr.lsr.dr) );   //Received Data Available Interrupt
 
@@ -491,29 +543,12 @@ import uart16550_pkg::*;
 
 
   /*
-   * Baud Generator
-   *
-   * The 16550 outputs a 16x 50/50 clock used as baudclock
-   * The IP generates a 16x clock enable signal instead
+   * Divisor Latch
+   * Drives the baud generator
    */
+  assign dl_o    = dl;
 
-  //Load baud counter when either of the Divisor Latch register are loaded (written to)
-  //Use a register as a delay. Ensure csr.dl is actually loaded before taking over the new value
-  always @(posedge clk_i)
-    ld_baud_cnt <= we_i & csr.lcr.dlab & (adr_i == DLL_ADR | adr_i == DLM_ADR);
-
-
-  //generate baud counter
-  always @(posedge clk_i, negedge rst_ni)
-    if (!rst_ni)
-      baud_cnt  <= 16'h0;
-    else if (ld_baud_cnt || ~|baud_cnt)
-      baud_cnt <= dl -1;
-    else
-      baud_cnt <= baud_cnt -1;
-
-  //generate baudout
-  always @(posedge clk_i)
-    baudout_o <= |dl & ~|baud_cnt;
+  //Either of the Divisor Latch registers is written to
+  assign dl_we_o = we_i & csr.lcr.dlab & (adr_i == DLL_ADR | adr_i == DLM_ADR);
 
 endmodule
@@ -88,15 +88,19 @@ import uart16550_pkg::*;
   //
   enum logic [2:0] {ST_IDLE=0, ST_START=1, ST_BYTE=2, ST_PARITY=3, ST_STOP=4} state;
 
-  logic       dsin;
+  logic [1:0] sin_sr;
+  logic       sin;
   logic       fallingedge_sin;
-  logic [3:0] cnt;
-  logic       cnt7,
+  logic [3:0] cnt,
+              cnt_load,
+              cnt_sample;
+  logic       cnt_centre,
               cnt0;
   logic [2:0] bitcnt;
 
   logic [7:0] break_load_value,
               break_cnt;
+  logic [1:0] break_shift;
 //  logic [9:0] timeout_load_value,
 //              timeout_cnt;
 
@@ -106,16 +110,51 @@ import uart16550_pkg::*;
   // Module Body
   //
 
-  //Detect falling edge of sin_i
+  //Store sin_i samples taken on the previous baudout ticks
   always @(posedge clk_i)
-    dsin <= sin_i;
+    if (baudout_i) sin_sr <= {sin_sr[0], sin_i};
+
 
-  assign fallingedge_sin = ~sin_i & dsin;
+  //Detect falling edge of sin_i
+  assign fallingedge_sin = ~sin_i & sin_sr[0];
+
+
+  /*
+   * Oversampling ratio
+   *
+   * cnt_load   : number of baudout ticks per bit -1
+   * cnt_sample : cnt value at which the bit is sampled
+   * sin        : sampled bit value
+   *
+   * 16x and 8x take a majority vote over the 3 samples around the bit centre
+   * 4x doesn't have enough samples for voting and takes the centre sample only
+   */
+  always_comb
+    case (csr_i.mcr.osr)
+      osr8   : begin
+                   cnt_load    = 4'd7;
+                   cnt_sample  = 4'd3;
+                   sin         = (sin_sr[1] & sin_sr[0]) | (sin_sr[1] & sin_i) | (sin_sr[0] & sin_i);
+                   break_shift = 2'd1;
+               end
+      osr4   : begin
+                   cnt_load    = 4'd3;
+                   cnt_sample  = 4'd2;
+                   sin         = sin_i;
+                   break_shift = 2'd2;
+               end
+      default: begin //16x
+                   cnt_load    = 4'd15;
+                   cnt_sample  = 4'd7;
+                   sin         = (sin_sr[1] & sin_sr[0]) | (sin_sr[1] & sin_i) | (sin_sr[0] & sin_i);
+                   break_shift = 2'd0;
+               end
+    endcase
 
 
   //bit counter steps
-  assign cnt7 = cnt == 4'h7;
-  assign cnt0 = ~|cnt;
+  assign cnt_centre = cnt == cnt_sample;
+  assign cnt0       = ~|cnt;
 
 
   //Rx FSM
@@ -144,14 +183,14 @@ import uart16550_pkg::*;
               ST_IDLE  : if (fallingedge_sin) //start bit detected
                          begin
                              state <= ST_START;
-                             cnt   <= 4'd15;    //start bit is 16 baudout cycles
+                             cnt   <= cnt_load; //start bit is 16/8/4 baudout cycles
                          end
 
 
               //check if this was a start or a spike
-              ST_START : if (cnt7)
+              ST_START : if (cnt_centre)
                          begin
-                             if (sin_i)
+                             if (sin)
                              begin
                                  //not a full start, assume spike and ignore
                                  state <= ST_IDLE;
@@ -161,18 +200,18 @@ import uart16550_pkg::*;
                          else if (cnt0)
                          begin
                              state  <= ST_BYTE;
-                             cnt    <= 4'd15;        //databit is 16 baudout cycles
+                             cnt    <= cnt_load;     //databit is 16/8/4 baudout cycles
                              bitcnt <= {1'b1,csr_i.lcr.wls};
                          end
 
 
-              ST_BYTE  : if (cnt7)
+              ST_BYTE  : if (cnt_centre)
                          begin
                              case (csr_i.lcr.wls) //Shift Register
-                               wls_5bits: q_o.d <= {3'h0, sin_i, q_o.d[4:1]};
-                               wls_6bits: q_o.d <= {2'h0, sin_i, q_o.d[5:1]};
-                               wls_7bits: q_o.d <= {1'h0, sin_i, q_o.d[6:1]};
-                               wls_8bits: q_o.d <= {      sin_i, q_o.d[7:1]};
+                               wls_5bits: q_o.d <= {3'h0, sin, q_o.d[4:1]};
+                               wls_6bits: q_o.d <= {2'h0, sin, q_o.d[5:1]};
+                               wls_7bits: q_o.d <= {1'h0, sin, q_o.d[6:1]};
+                               wls_8bits: q_o.d <= {      sin, q_o.d[7:1]};
                              endcase
                          end
                          else if (cnt0)
@@ -180,37 +219,36 @@ import uart16550_pkg::*;
                              //have all bits been transmitted
                              if (~|bitcnt) state <= csr_i.lcr.pen ? ST_PARITY : ST_STOP;
 
-                             cnt    <= 4'd15;                               //data/paritybit is 16baudout cycles
+                             cnt    <= cnt_load;                            //data/paritybit is 16/8/4 baudout cycles
                              bitcnt <= bitcnt -1;                           //next databit
                          end
 
 
-              ST_PARITY: if (cnt7)
+              ST_PARITY: if (cnt_centre)
                          begin
                              case ({csr_i.lcr.stick_parity, csr_i.lcr.eps})
-                                2'b00: q_o.pe <= ~^{sin_i,q_o.d};           //odd parity
-                                2'b01: q_o.pe <=  ^{sin_i,q_o.d};           //even parity
-                                2'b10: q_o.pe <= ~sin_i;                    //parity should have been a '1'
-                                2'b11: q_o.pe <=  sin_i;                    //parity should have been a '0'
+                                2'b00: q_o.pe <= ~^{sin,q_o.d};             //odd parity
+                                2'b01: q_o.pe <=  ^{sin,q_o.d};             //even parity
+                                2'b10: q_o.pe <= ~sin;                      //parity should have been a '1'
+                                2'b11: q_o.pe <=  sin;                      //parity should have been a '0'
                               endcase
                          end
                          else if (cnt0)
                          begin
                              state <= ST_STOP;
-                             cnt   <= 4'd15;
+                             cnt   <= cnt_load;
                          end
 
 
-              ST_STOP  : if (cnt7)
+              //Return to IDLE at the stop bit centre, this way a start
+              //bit from a slightly faster transmitter isn't missed
+              ST_STOP  : if (cnt_centre)
                          begin
-                             q_o.fe <= ~sin_i;   //FrameError: sin_i should have been a '1' for stop
+                             state  <= ST_IDLE;
+                             cnt    <= 4'dx;     //don't care
+                             q_o.fe <= ~sin;     //FrameError: sin should have been a '1' for stop
                              push_o <= 1'b1;     //push data into RBR/RxFIFO
                          end
-                         else if (cnt0)
-                         begin
-                             state <= ST_IDLE;
-                             cnt   <= 4'dx;      //don't care
-                         end
 
               //We should never end up here!
               default  : begin
@@ -225,24 +263,25 @@ import uart16550_pkg::*;
   //Timeout and BREAK
 
   //break counter load value
+  //Values are for 16x oversampling, scaled down for 8x and 4x
   always_comb
     case ({csr_i.lcr.pen, csr_i.lcr.stb, csr_i.lcr.wls})
-      {2'b00, wls_5bits}: break_load_value = 8'd112; //Start, no parity, 5 data, 1 stop   ( 7)
-      {2'b00, wls_6bits}: break_load_value = 8'd128; //Start, no parity, 6 data, 1 stop   ( 8)
-      {2'b00, wls_7bits}: break_load_value = 8'd144; //Start, no parity, 7 data, 1 stop   ( 9)
-      {2'b00, wls_8bits}: break_load_value = 8'd160; //Start, no parity, 8 data, 1 stop   (10)
-      {2'b01, wls_5bits}: break_load_value = 8'd120; //Start, no parity, 5 data, 1.5 stop ( 7.5)
-      {2'b01, wls_6bits}: break_load_value = 8'd144; //Start, no parity, 6 data, 2 stop   ( 9)
-      {2'b01, wls_7bits}: break_load_value = 8'd160; //Start, no parity, 7 data, 2 stop   (10)
-      {2'b01, wls_8bits}: break_load_value = 8'd176; //Start, no parity, 8 data, 2 stop   (11)
-      {2'b10, wls_5bits}: break_load_value = 8'd128; //Start,    parity, 5 data, 1 stop   ( 8)
-      {2'b10, wls_6bits}: break_load_value = 8'd144; //Start,    parity, 6 data, 1 stop   ( 9)
-      {2'b10, wls_7bits}: break_load_value = 8'd160; //Start,    parity, 7 data, 1 stop   (10)
-      {2'b10, wls_8bits}: break_load_value = 8'd176; //Start,    parity, 8 data, 1 stop   (11)
-      {2'b11, wls_5bits}: break_load_value = 8'd136; //Start,    parity, 5 data, 1.5 stop ( 8.5)
-      {2'b11, wls_6bits}: break_load_value = 8'd160; //Start,    parity, 6 data, 2 stop   (10)
-      {2'b11, wls_7bits}: break_load_value = 8'd176; //Start,    parity, 7 data, 2 stop   (11)
-      {2'b11, wls_8bits}: break_load_value = 8'd192; //Start,    parity, 8 data, 2 stop   (12)
+      {2'b00, wls_5bits}: break_load_value = 8'd112 >> break_shift; //Start, no parity, 5 data, 1 stop   ( 7)
+      {2'b00, wls_6bits}: break_load_value = 8'd128 >> break_shift; //Start, no parity, 6 data, 1 stop   ( 8)
+      {2'b00, wls_7bits}: break_load_value = 8'd144 >> break_shift; //Start, no parity, 7 data, 1 stop   ( 9)
+      {2'b00, wls_8bits}: break_load_value = 8'd160 >> break_shift; //Start, no parity, 8 data, 1 stop   (10)
+      {2'b01, wls_5bits}: break_load_value = 8'd120 >> break_shift; //Start, no parity, 5 data, 1.5 stop ( 7.5)
+      {2'b01, wls_6bits}: break_load_value = 8'd144 >> break_shift; //Start, no parity, 6 data, 2 stop   ( 9)
+      {2'b01, wls_7bits}: break_load_value = 8'd160 >> break_shift; //Start, no parity, 7 data, 2 stop   (10)
+      {2'b01, wls_8bits}: break_load_value = 8'd176 >> break_shift; //Start, no parity, 8 data, 2 stop   (11)
+      {2'b10, wls_5bits}: break_load_value = 8'd128 >> break_shift; //Start,    parity, 5 data, 1 stop   ( 8)
+      {2'b10, wls_6bits}: break_load_value = 8'd144 >> break_shift; //Start,    parity, 6 data, 1 stop   ( 9)
+      {2'b10, wls_7bits}: break_load_value = 8'd160 >> break_shift; //Start,    parity, 7 data, 1 stop   (10)
+      {2'b10, wls_8bits}: break_load_value = 8'd176 >> break_shift; //Start,    parity, 8 data, 1 stop   (11)
+      {2'b11, wls_5bits}: break_load_value = 8'd136 >> break_shift; //Start,    parity, 5 data, 1.5 stop ( 8.5)
+      {2'b11, wls_6bits}: break_load_value = 8'd160 >> break_shift; //Start,    parity, 6 data, 2 stop   (10)
+      {2'b11, wls_7bits}: break_load_value = 8'd176 >> break_shift; //Start,    parity, 7 data, 2 stop   (11)
+      {2'b11, wls_8bits}: break_load_value = 8'd192 >> break_shift; //Start,    parity, 8 data, 2 stop   (12)
     endcase
 
 
@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////
+//   ,------.                    ,--.                ,--.          //
+//   |  .--. ' ,---.  ,--,--.    |  |    ,---. ,---. `--' ,---.    //
+//   |  '--'.'| .-. |' ,-.  |    |  |   | .-. | .-. |,--.| .--'    //
+//   |  |\  \ ' '-' '\ '-'  |    |  '--.' '-' ' '-' ||  |\ `--.    //
+//   `--' '--' `---'  `--`--'    `-----' `---' `-   /`--' `---'    //
+//                                             `---'               //
+//    UART16550 Synchroniser Module                                //
+//                                                                 //
+/////////////////////////////////////////////////////////////////////
+//                                                                 //
+//             Copyright (C) 2024 Roa Logic BV                     //
+//             www.roalogic.com                                    //
+//                                                                 //
+//   This source file may be used and distributed without          //
+//   restriction provided that this copyright statement is not     //
+//   removed from the file and that any derivative work contains   //
+//   the original copyright notice and the associated disclaimer.  //
+//                                                                 //
+//      THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY        //
+//   EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED     //
+//   TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS     //
+//   FOR A PARTICULAR PURPOSE. IN NO EVENT SHALL THE AUTHOR OR     //
+//   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,  //
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT  //
+//   NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;  //
+//   LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)      //
+//   HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN     //
+//   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR  //
+//   OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS          //
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  //
+//                                                                 //
+/////////////////////////////////////////////////////////////////////
+
+// +FHDR -  Semiconductor Reuse Standard File Header Section  -------
+// FILE NAME      : uart16550_sync.sv
+// DEPARTMENT     :
+// AUTHOR         : roalogic
+// AUTHOR'S EMAIL :
+// ------------------------------------------------------------------
+// RELEASE HISTORY
+// VERSION DATE        AUTHOR      DESCRIPTION
+// 1.0     2026-10-19  roalogic    initial release
+// ------------------------------------------------------------------
+// KEYWORDS : AMBA APB4 16550 compatible UART     
+// ------------------------------------------------------------------
+// PURPOSE  : UART 16550
+// ------------------------------------------------------------------
+// PARAMETERS
+//  PARAM NAME        RANGE    DESCRIPTION              DEFAULT UNITS
+//
+// ------------------------------------------------------------------
+// REUSE ISSUES 
+//   Reset Strategy      : external asynchronous active low; rst_ni
+//   Clock Domains       : clk_i, rising edge
+//   Critical Timing     : 
+//   Test Features       : na
+//   Asynchronous I/F    : yes; d_i
+//   Scan Methodology    : na
+//   Instantiations      : na
+//   Synthesizable (y/n) : Yes
+//   Other               :                                         
+
+
+
+/*
+ * Multi-stage flip-flop synchroniser
+ *
+ * Bits are synchronised individually. Multi-bit values must either be
+ * Gray coded or quasi static (e.g. configuration registers)
+ */
+module uart16550_sync
+#(
+  parameter int             WIDTH       = 1,
+  parameter int             STAGES      = 2,
+  parameter [WIDTH    -1:0] RESET_VALUE = {WIDTH{1'b0}}
+)
+(
+  input  logic             rst_ni,     //Asynchronous active low reset
+  input  logic             clk_i,      //Destination clock
+
+  input  logic [WIDTH-1:0] d_i,        //Asynchronous input
+  output logic [WIDTH-1:0] q_o         //Synchronised output
+);
+
+  //////////////////////////////////////////////////////////////////
+  //
+  // Variables
+  //
+  logic [WIDTH-1:0] sync [STAGES];
+
+
+  //////////////////////////////////////////////////////////////////
+  //
+  // Module Body
+  //
+  always @(posedge clk_i, negedge rst_ni)
+    if (!rst_ni)
+      for (int n=0; n < STAGES; n++) sync[n] <= RESET_VALUE;
+    else
+    begin
+        sync[0] <= d_i;
+
+        for (int n=1; n < STAGES; n++) sync[n] <= sync[n-1];
+    end
+
+
+  assign q_o = sync[STAGES-1];
+
+endmodule
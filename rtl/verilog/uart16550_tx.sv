@@ -76,6 +76,7 @@ import uart16550_pkg::*;
   input  csr_t       csr_i,
 /* verilator lint_on UNUSEDSIGNAL */
 
+  input  logic       empty_i,
   output logic       pop_o,
   input  logic [7:0] d_i,
 
@@ -93,7 +94,10 @@ import uart16550_pkg::*;
   logic [7:0] sr;
   logic       sout;
   logic       data_parity;
-  logic [4:0] cnt;
+  logic [4:0] cnt,
+              cnt_bit,
+              cnt_stop15,
+              cnt_stop2;
   logic [2:0] bitcnt;
 
 
@@ -102,6 +106,29 @@ import uart16550_pkg::*;
   // Module Body
   //
 
+  /*
+   * Oversampling ratio
+   * Number of baudout ticks (-1) for a single bit, 1.5 and 2 stop bits
+   */
+  always_comb
+    case (csr_i.mcr.osr)
+      osr8   : begin
+                   cnt_bit    = 5'd7;
+                   cnt_stop15 = 5'd11;
+                   cnt_stop2  = 5'd15;
+               end
+      osr4   : begin
+                   cnt_bit    = 5'd3;
+                   cnt_stop15 = 5'd5;
+                   cnt_stop2  = 5'd7;
+               end
+      default: begin //16x
+                   cnt_bit    = 5'd15;
+                   cnt_stop15 = 5'd23;
+                   cnt_stop2  = 5'd31;
+               end
+    endcase
+
 
   always @(posedge clk_i, negedge rst_ni)
     if (!rst_ni)
@@ -122,13 +149,14 @@ import uart16550_pkg::*;
 
         if (baudout_i)
         begin
-            cnt <= cnt -1;
+            //don't wrap while idle; start transmission as soon as data is available
+            if (|cnt) cnt <= cnt -1;
 
             case (state)
               //wait until there's data in the Tx FIFO/Register and the stop-bit has been trasmitted
               ST_IDLE : if (~|cnt)
                         begin
-                            if (!csr_i.lsr.thre)
+                            if (!empty_i)
                             begin
                                 state      <= ST_START; 
 
@@ -146,7 +174,7 @@ import uart16550_pkg::*;
                                 bitcnt     <= {1'b1,csr_i.lcr.wls};
 
                                 sout       <= 1'b0;                                //start bit = '0'
-                                cnt        <= 5'd15;                               //start bit is 16 baudout cycles
+                                cnt        <= cnt_bit;                             //start bit is 16/8/4 baudout cycles
                             end
                          end
 
@@ -161,7 +189,7 @@ import uart16550_pkg::*;
                              sr     <= sr >> 1;
 
                              sout   <= sr[0];
-                             cnt    <= 5'd15;                                      //data bit is 16 baudout cycles
+                             cnt    <= cnt_bit;                                    //data bit is 16/8/4 baudout cycles
                          end
 
 
@@ -172,7 +200,7 @@ import uart16550_pkg::*;
                              sr   <= sr >> 1;
                              bitcnt <= bitcnt -1;
                              sout   <= sr[0];
-                             cnt    <= 5'd15;                                      //databit is 16 baudout cycles
+                             cnt    <= cnt_bit;                                    //databit is 16/8/4 baudout cycles
 
 
                              //have all bits been transmitted?
@@ -190,16 +218,16 @@ import uart16550_pkg::*;
                                        2'b10: sout <= 1'b1;                        //forced 1
                                        2'b11: sout <= 1'b0;                        //forced 0
                                      endcase
-                                     cnt   <= 5'd15;                               //Parity is 16 baudout cycles
+                                     cnt   <= cnt_bit;                             //Parity is 16/8/4 baudout cycles
                                  end
                                  else
                                  begin
                                      state <= ST_IDLE;
 
                                      sout  <= 1'b1;                                //stop bit = '1'
-                                     cnt   <= !csr_i.lcr.stb ? 5'd15      :        //1 stop bit
-                                               csr_i.lcr.wls == wls_5bits ? 5'd17  //1.5 stop bits
-                                                                          : 5'd31; //2 stop bits
+                                     cnt   <= !csr_i.lcr.stb ? cnt_bit    :               //1 stop bit
+                                               csr_i.lcr.wls == wls_5bits ? cnt_stop15    //1.5 stop bits
+                                                                          : cnt_stop2;    //2 stop bits
                                  end
                              end
                          end
@@ -210,9 +238,9 @@ import uart16550_pkg::*;
                              state <= ST_IDLE;
 
                              sout  <= 1'b1;                                        //stop bit = '1'
-                             cnt   <= !csr_i.lcr.stb ? 5'd15      :                //1 stop bit
-                                       csr_i.lcr.wls == wls_5bits ? 5'd23          //1.5 stop bits
-                                                                  : 5'd31;         //2 stop bits
+                             cnt   <= !csr_i.lcr.stb ? cnt_bit    :                //1 stop bit
+                                       csr_i.lcr.wls == wls_5bits ? cnt_stop15     //1.5 stop bits
+                                                                  : cnt_stop2;     //2 stop bits
                          end
 
             endcase //state